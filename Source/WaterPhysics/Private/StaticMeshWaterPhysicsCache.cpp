@@ -0,0 +1,84 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#include "StaticMeshWaterPhysicsCache.h"
+#include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
+#include "Misc/ScopeLock.h"
+
+TMap<FStaticMeshWaterPhysicsCache::FKey, TWeakPtr<const FStaticMeshWaterPhysicsCache::FEntry, ESPMode::ThreadSafe>> FStaticMeshWaterPhysicsCache::Entries;
+FCriticalSection FStaticMeshWaterPhysicsCache::EntriesCS;
+
+FStaticMeshWaterPhysicsCache::FEntryPtr FStaticMeshWaterPhysicsCache::FindOrExtract(const UStaticMesh* StaticMesh, int32 LOD)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(StaticMeshWaterPhysicsCache_FindOrExtract);
+
+	if (!IsValid(StaticMesh) || !StaticMesh->bAllowCPUAccess)
+		return nullptr;
+
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+	if (!RenderData || !RenderData->LODResources.IsValidIndex(LOD))
+		return nullptr;
+
+	const FKey Key = { StaticMesh, LOD };
+
+	FScopeLock Lock(&EntriesCS);
+
+	if (const TWeakPtr<const FEntry, ESPMode::ThreadSafe>* ExistingEntry = Entries.Find(Key))
+	{
+		FEntryPtr Entry = ExistingEntry->Pin();
+		if (Entry.IsValid() && Entry->SourceRenderData == RenderData)
+			return Entry;
+	}
+
+	FEntryPtr Entry = ExtractMesh(StaticMesh, LOD);
+	if (!Entry.IsValid())
+		return nullptr;
+
+	// Prune entries which are no longer referenced before adding the new one
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+			It.RemoveCurrent();
+	}
+
+	Entries.Add(Key, Entry);
+
+	return Entry;
+}
+
+FStaticMeshWaterPhysicsCache::FEntryPtr FStaticMeshWaterPhysicsCache::ExtractMesh(const UStaticMesh* StaticMesh, int32 LOD)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(StaticMeshWaterPhysicsCache_ExtractMesh);
+
+	const FStaticMeshRenderData* RenderData = StaticMesh->GetRenderData();
+
+	const FStaticMeshLODResources& LODResource = RenderData->LODResources[LOD];
+	const FIndexArrayView IndexArray = LODResource.IndexBuffer.GetArrayView();
+	const FPositionVertexBuffer& PositionVertexBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
+
+	if (IndexArray.Num() == 0 || PositionVertexBuffer.GetNumVertices() == 0)
+		return nullptr;
+
+	TSharedRef<FEntry, ESPMode::ThreadSafe> Entry = MakeShared<FEntry, ESPMode::ThreadSafe>();
+	Entry->SourceRenderData = RenderData;
+
+	WaterPhysics::FIndexedTriangleMesh& Mesh = Entry->Mesh;
+
+	Mesh.IndexList.SetNumUninitialized(IndexArray.Num());
+	for (int32 i = 0; i < IndexArray.Num(); i += 3)
+	{
+		// Flip triangle normal by adding the indices in reverse
+		Mesh.IndexList[i+0] = IndexArray[i+2];
+		Mesh.IndexList[i+1] = IndexArray[i+1];
+		Mesh.IndexList[i+2] = IndexArray[i+0];
+	}
+
+	Mesh.VertexList.SetNumUninitialized(PositionVertexBuffer.GetNumVertices());
+	for (uint32 i = 0; i < PositionVertexBuffer.GetNumVertices(); i++)
+	{
+		const FVector3f& VertexPosition = PositionVertexBuffer.VertexPosition(i);
+		Mesh.VertexList[i] = FVector(VertexPosition.X, VertexPosition.Y, VertexPosition.Z);
+	}
+
+	return Entry;
+}
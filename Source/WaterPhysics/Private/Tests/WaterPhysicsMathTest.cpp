@@ -0,0 +1,63 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "WaterPhysicsMath.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWaterPhysicsVectorFastPowTest, "WaterPhysics.Math.VectorFastPow",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWaterPhysicsVectorFastPowTest::RunTest(const FString& Parameters)
+{
+	// The drag and slamming forces raise values in [0, 1] to user set exponents, bases above 1 are covered as well
+	constexpr int32 NumBases         = 4000;
+	constexpr float MaxBase          = 10.f;
+	constexpr float MaxExponent      = 10.f;
+	constexpr float ExponentStep     = 0.25f;
+	constexpr float MaxRelativeError = 2e-4f;
+
+	float WorstRelativeError = 0.f;
+	float WorstBase          = 0.f;
+	float WorstExponent      = 0.f;
+
+	for (float Exponent = 0.f; Exponent <= MaxExponent; Exponent += ExponentStep)
+	{
+		for (int32 i = 1; i <= NumBases; i += 4)
+		{
+			alignas(16) float Bases[4];
+			alignas(16) float Results[4];
+			for (int32 j = 0; j < 4; ++j)
+				Bases[j] = (i + j) * (MaxBase / NumBases);
+
+			VectorStoreAligned(VectorFastPow(VectorLoadAligned(Bases), VectorSetFloat1(Exponent)), Results);
+
+			for (int32 j = 0; j < 4; ++j)
+			{
+				const double Expected      = FMath::Pow((double)Bases[j], (double)Exponent);
+				const float  RelativeError = (float)(FMath::Abs(Results[j] - Expected) / Expected);
+				if (RelativeError > WorstRelativeError)
+				{
+					WorstRelativeError = RelativeError;
+					WorstBase          = Bases[j];
+					WorstExponent      = Exponent;
+				}
+			}
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Worst relative error %g at Pow(%g, %g)"), WorstRelativeError, WorstBase, WorstExponent));
+	TestTrue(TEXT("Relative error against FMath::Pow"), WorstRelativeError < MaxRelativeError);
+
+	// Zero bases behave like FMath::Pow
+	alignas(16) float ZeroBaseResults[4];
+	VectorStoreAligned(VectorFastPow(VectorZeroFloat(), MakeVectorRegister(0.f, 0.5f, 1.f, 10.f)), ZeroBaseResults);
+	TestEqual(TEXT("Pow(0, 0)"),   ZeroBaseResults[0], 1.f);
+	TestEqual(TEXT("Pow(0, 0.5)"), ZeroBaseResults[1], 0.f);
+	TestEqual(TEXT("Pow(0, 1)"),   ZeroBaseResults[2], 0.f);
+	TestEqual(TEXT("Pow(0, 10)"),  ZeroBaseResults[3], 0.f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,175 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "WaterPhysicsScene.h"
+#include "Algo/AllOf.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace WaterPhysicsTriangulationTest
+{
+	using namespace WaterPhysics;
+
+	bool IsClosed(const FIndexedTriangleMesh& Mesh)
+	{
+		const FTriangleMeshEdges Edges = BuildTriangleMeshEdges(Mesh);
+
+		TArray<int32> EdgeUseCount;
+		EdgeUseCount.SetNumZeroed(Edges.NumEdges);
+		for (const int32 EdgeIndex : Edges.EdgeIndexList)
+			EdgeUseCount[EdgeIndex]++;
+
+		return EdgeUseCount.Num() > 0 && Algo::AllOf(EdgeUseCount, [](int32 Count) { return Count == 2; });
+	}
+
+	// Divergence theorem, sum of the signed volumes of the tetrahedrons formed by each triangle and the origin
+	double CalcVolume(const FIndexedTriangleMesh& Mesh)
+	{
+		double Volume = 0.0;
+		for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
+		{
+			const FVector& A = Mesh.VertexList[Mesh.IndexList[i + 0]];
+			const FVector& B = Mesh.VertexList[Mesh.IndexList[i + 1]];
+			const FVector& C = Mesh.VertexList[Mesh.IndexList[i + 2]];
+			Volume += FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 6.0;
+		}
+		return Volume;
+	}
+
+	// Volume of the part of the mesh below the height. The tetrahedrons are formed with a point on the cutting plane, 
+	// so the cap closing the cut adds nothing and does not need to be built.
+	double CalcVolumeBelow(const FIndexedTriangleMesh& Mesh, double Height)
+	{
+		const FVector Origin(0.0, 0.0, Height);
+
+		double Volume = 0.0;
+		for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
+		{
+			TArray<FVector, TInlineAllocator<4>> Below;
+			for (int32 Corner = 0; Corner < 3; Corner++)
+			{
+				const FVector P0 = Mesh.VertexList[Mesh.IndexList[i + Corner]] - Origin;
+				const FVector P1 = Mesh.VertexList[Mesh.IndexList[i + (Corner + 1) % 3]] - Origin;
+
+				if (P0.Z <= 0.0)
+					Below.Add(P0);
+				if ((P0.Z > 0.0 && P1.Z < 0.0) || (P0.Z < 0.0 && P1.Z > 0.0))
+					Below.Add(FMath::Lerp(P0, P1, P0.Z / (P0.Z - P1.Z)));
+			}
+
+			for (int32 Corner = 1; Corner < Below.Num() - 1; Corner++)
+				Volume += FVector::DotProduct(Below[0], FVector::CrossProduct(Below[Corner], Below[Corner + 1])) / 6.0;
+		}
+		return Volume;
+	}
+
+	FWaterPhysicsCollisionSetup MakeTwoBoxes(const FVector& SecondBoxCenter)
+	{
+		FWaterPhysicsCollisionSetup CollisionSetup;
+		CollisionSetup.BoxElems.Add({ FVector::ZeroVector, FRotator::ZeroRotator, FVector(50.0) });
+		CollisionSetup.BoxElems.Add({ SecondBoxCenter,     FRotator::ZeroRotator, FVector(50.0) });
+		return CollisionSetup;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWaterPhysicsOverlappingElemsTest, "WaterPhysics.Triangulation.OverlappingElems", 
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWaterPhysicsOverlappingElemsTest::RunTest(const FString& Parameters)
+{
+	using namespace WaterPhysicsTriangulationTest;
+
+	struct FTestCase
+	{
+		const TCHAR* Name;
+		FVector      SecondBoxCenter;
+		int32        BoxSubdivision;
+		double       ExpectedVolume;
+	};
+
+	// Two 100cm cubes, overlapping by half of their size along one axis and by 75cm along every axis
+	const FTestCase TestCases[] =
+	{
+		{ TEXT("Overlap along X"),               FVector(50.0, 0.0, 0.0),   0, 1.5e6 },
+		{ TEXT("Overlap along X, subdivided"),   FVector(50.0, 0.0, 0.0),   2, 1.5e6 },
+		{ TEXT("Overlap along XYZ"),             FVector(25.0, 25.0, 25.0), 0, 2e6 - 75.0 * 75.0 * 75.0 },
+		{ TEXT("Overlap along XYZ, subdivided"), FVector(25.0, 25.0, 25.0), 2, 2e6 - 75.0 * 75.0 * 75.0 },
+	};
+
+	for (const FTestCase& TestCase : TestCases)
+	{
+		FTriangleSubdivisionSettings SubdivisionSettings;
+		SubdivisionSettings.Box = TestCase.BoxSubdivision;
+
+		const FIndexedTriangleMesh Mesh = TriangulateWaterPhysicsCollisionSetup(MakeTwoBoxes(TestCase.SecondBoxCenter), SubdivisionSettings);
+
+		TestTrue(FString::Printf(TEXT("%s: Mesh is closed"), TestCase.Name), IsClosed(Mesh));
+		TestEqual(FString::Printf(TEXT("%s: Volume"), TestCase.Name), CalcVolume(Mesh), TestCase.ExpectedVolume, 1.0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWaterPhysicsOverlappingCurvedElemsTest, "WaterPhysics.Triangulation.OverlappingCurvedElems", 
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWaterPhysicsOverlappingCurvedElemsTest::RunTest(const FString& Parameters)
+{
+	using namespace WaterPhysicsTriangulationTest;
+
+	struct FTestCase
+	{
+		const TCHAR* Name;
+		bool         bCapsule;
+		float        Radius;
+		float        HalfHeight;
+		FVector      Center;
+		FRotator     Rotation;
+		int32        Subdivision;
+	};
+
+	// A sphere or capsule sticking out of the top face of a 100cm cube, it stays within the cube's sides and above its bottom
+	const FTestCase TestCases[] =
+	{
+		{ TEXT("Sphere mostly above"),        false, 30.f, 0.f,  FVector(0.0, 0.0, 60.0),   FRotator::ZeroRotator,     0 },
+		{ TEXT("Sphere centered on the face"), false, 30.f, 0.f,  FVector(0.0, 0.0, 50.0),   FRotator::ZeroRotator,     1 },
+		{ TEXT("Sphere off center"),           false, 30.f, 0.f,  FVector(10.0, -5.0, 40.0), FRotator::ZeroRotator,     2 },
+		{ TEXT("Capsule upright"),             true,  20.f, 30.f, FVector(0.0, 0.0, 50.0),   FRotator::ZeroRotator,     1 },
+		{ TEXT("Capsule tilted"),              true,  20.f, 30.f, FVector(10.0, 0.0, 60.0),  FRotator(30.0, 0.0, 0.0),  1 },
+		{ TEXT("Capsule lying on the face"),   true,  20.f, 20.f, FVector(0.0, 0.0, 50.0),   FRotator(90.0, 0.0, 0.0),  2 },
+		{ TEXT("Capsule tilted off center"),   true,  20.f, 20.f, FVector(5.0, 5.0, 45.0),   FRotator(-45.0, 0.0, 0.0), 2 },
+	};
+
+	for (const FTestCase& TestCase : TestCases)
+	{
+		FWaterPhysicsCollisionSetup ElemSetup;
+		FTriangleSubdivisionSettings SubdivisionSettings;
+		if (TestCase.bCapsule)
+		{
+			ElemSetup.SphylElems.Add({ TestCase.Center, TestCase.Rotation, TestCase.Radius, TestCase.HalfHeight });
+			SubdivisionSettings.Capsule = TestCase.Subdivision;
+		}
+		else
+		{
+			ElemSetup.SphereElems.Add({ TestCase.Center, TestCase.Radius });
+			SubdivisionSettings.Sphere = TestCase.Subdivision;
+		}
+
+		FWaterPhysicsCollisionSetup CollisionSetup = ElemSetup;
+		CollisionSetup.BoxElems.Add({ FVector::ZeroVector, FRotator::ZeroRotator, FVector(50.0) });
+
+		// The union is the cube plus the part of the element's triangulation above the cube
+		const FIndexedTriangleMesh ElemMesh = TriangulateWaterPhysicsCollisionSetup(ElemSetup, SubdivisionSettings);
+		const double ExpectedVolume = 1e6 + CalcVolume(ElemMesh) - CalcVolumeBelow(ElemMesh, 50.0);
+
+		const FIndexedTriangleMesh Mesh = TriangulateWaterPhysicsCollisionSetup(CollisionSetup, SubdivisionSettings);
+
+		TestTrue(FString::Printf(TEXT("%s: Element is closed"), TestCase.Name), IsClosed(ElemMesh));
+		TestTrue(FString::Printf(TEXT("%s: Mesh is closed"), TestCase.Name), IsClosed(Mesh));
+		TestEqual(FString::Printf(TEXT("%s: Volume"), TestCase.Name), CalcVolume(Mesh), ExpectedVolume, 1.0);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -119,6 +119,25 @@ UWaterPhysicsCollisionComponent::UWaterPhysicsCollisionComponent()
 #endif
 }
 
+void UWaterPhysicsCollisionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UpdateCachedMesh();
+}
+
+void UWaterPhysicsCollisionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CachedMesh.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UWaterPhysicsCollisionComponent::UpdateCachedMesh()
+{
+	CachedMesh = CollisionType == EWaterPhysicsCollisionType::Mesh ? FStaticMeshWaterPhysicsCache::FindOrExtract(Mesh, LOD) : nullptr;
+}
+
 #if WITH_EDITOR
 void UWaterPhysicsCollisionComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -159,6 +178,9 @@ void UWaterPhysicsCollisionComponent::PostEditChangeProperty(FPropertyChangedEve
 		}
 	}
 
+	if (HasBegunPlay())
+		UpdateCachedMesh();
+
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
 #endif	// WITH_EDITOR
@@ -188,35 +210,13 @@ FWaterPhysicsCollisionSetup UWaterPhysicsCollisionComponent::GenerateWaterPhysic
 		if (!IsValid(Mesh) || !Mesh->bAllowCPUAccess)
 			break;
 
-		FStaticMeshRenderData* RenderData = Mesh->GetRenderData();
-		if (!RenderData || !RenderData->LODResources.IsValidIndex(LOD))
+		// The extracted mesh is shared between all components using the same Mesh and LOD, so it only has to be read from the render data once.
+		const FStaticMeshWaterPhysicsCache::FEntryPtr SharedMesh = FStaticMeshWaterPhysicsCache::FindOrExtract(Mesh, LOD);
+		if (!SharedMesh.IsValid())
 			break;
 
-		// We should probably allow this to be cached as fetching this information each frame can get expensive.
-		const FStaticMeshLODResources& LODResource = RenderData->LODResources[LOD];
-		const FIndexArrayView IndexArray = LODResource.IndexBuffer.GetArrayView();
-		const FPositionVertexBuffer& PositionVertexBuffer = LODResource.VertexBuffers.PositionVertexBuffer;
-
-		if (IndexArray.Num() == 0 || PositionVertexBuffer.GetNumVertices() == 0)
-			break;
-
-		FWaterPhysicsCollisionSetup::FMeshElem& MeshElem = OutCollisionSetup.MeshElems[OutCollisionSetup.MeshElems.AddDefaulted()];
-
-		MeshElem.IndexList.SetNumUninitialized(IndexArray.Num());
-		for (int32 i = 0; i < IndexArray.Num(); i += 3)
-		{
-			// Flip triangle normal by adding the indices in reverse
-			MeshElem.IndexList[i+0] = IndexArray[i+2];
-			MeshElem.IndexList[i+1] = IndexArray[i+1];
-			MeshElem.IndexList[i+2] = IndexArray[i+0];
-		}
-
-		MeshElem.VertexList.SetNumUninitialized(PositionVertexBuffer.GetNumVertices());
-		for (uint32 i = 0; i < PositionVertexBuffer.GetNumVertices(); i++)
-		{
-			auto VertexPosition = PositionVertexBuffer.VertexPosition(i);
-			MeshElem.VertexList[i] = FVector(VertexPosition.X, VertexPosition.Y, VertexPosition.Z);
-		}
+		// Reference the cached mesh instead of copying it, the collision setup keeps the cache entry alive
+		OutCollisionSetup.MeshElems.Emplace(FWaterPhysicsCollisionSetup::FMeshElem::FSharedMesh(SharedMesh, &SharedMesh->Mesh));
 
 		break;
 	}
@@ -239,13 +239,7 @@ FWaterPhysicsCollisionSetup UWaterPhysicsCollisionComponent::GenerateWaterPhysic
 		{
 			FTransform LocalConvexElemTransform = ConvexElem.GetTransform();
 			const bool bUseNegX = CalcMeshNegScaleCompensation(GetComponentScale(), LocalConvexElemTransform);
-			WaterPhysics::FIndexedTriangleMesh ConvexMesh = ExtractConvexElemTriangles(ConvexElem, bUseNegX);
-
-			FWaterPhysicsCollisionSetup::FMeshElem MeshElem;
-			MeshElem.VertexList = MoveTemp(ConvexMesh.VertexList);
-			MeshElem.IndexList = MoveTemp(ConvexMesh.IndexList);
-
-			OutCollisionSetup.MeshElems.Add(MeshElem);
+			OutCollisionSetup.MeshElems.Emplace(ExtractConvexElemTriangles(ConvexElem, bUseNegX));
 		}
 
 		break;
@@ -276,4 +270,16 @@ FBodyInstance* UWaterPhysicsCollisionComponent::GetWaterPhysicsCollisionBodyInst
 TArray<FName> UWaterPhysicsCollisionComponent::GetAllBodyNames() const
 {
 	return { GetAttachSocketName() };
-}
\ No newline at end of file
+}
+
+uint32 UWaterPhysicsCollisionComponent::GetWaterPhysicsCollisionSetupHash(const FName& BodyName) const
+{
+	uint32 Hash = HashCombine(GetTypeHash(CollisionType), GetTypeHash(Mesh));
+	Hash = HashCombine(Hash, GetTypeHash(LOD));
+	Hash = HashCombine(Hash, GetTypeHash(IsValid(Mesh) ? Mesh->GetRenderData() : nullptr)); // Changes when the mesh gets rebuilt
+	Hash = HashCombine(Hash, GetTypeHash(BoxExtent));
+	Hash = HashCombine(Hash, GetTypeHash(SphereRadius));
+	Hash = HashCombine(Hash, GetTypeHash(CapsuleHalfHeight));
+	Hash = HashCombine(Hash, GetTypeHash(CapsuleRadius));
+	return Hash != 0 ? Hash : 1; // 0 is reserved for "do not cache"
+}
@@ -3,11 +3,14 @@
 #pragma once
 #include "DrawDebugHelpers.h"
 #include "WaterPhysicsTypes.h"
+#include "WaterPhysicsFrameArena.h"
 #include "Stats/Stats.h"
 
 #if WITH_WATER_PHYS_DEBUG
 #define EXEC_WITH_WATER_PHYS_DEBUG(Block) Block
-#define EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(Func) FFunctionGraphTask::CreateAndDispatchWhenReady(Func, TStatId(), nullptr, ENamedThreads::GameThread);
+// Runs outside of any frame arena scope, the game thread may pick the task up in the middle of another scene's step
+#define EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(Func) FFunctionGraphTask::CreateAndDispatchWhenReady( \
+	[DebugFunc = Func]() { FWaterPhysicsFrameArena::FScope NoFrameArena(nullptr); DebugFunc(); }, TStatId(), nullptr, ENamedThreads::GameThread);
 #else
 #define EXEC_WITH_WATER_PHYS_DEBUG(Block)
 #define EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(Block)
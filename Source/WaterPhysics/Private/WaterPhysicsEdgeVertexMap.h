@@ -0,0 +1,97 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+namespace WaterPhysics
+{
+	struct FEdgeKey
+	{
+		uint64 Key;
+
+		FEdgeKey() = default;
+
+		explicit FEdgeKey(uint32 A, uint32 B)
+			: Key(((uint64)FMath::Max(A, B) << 32) | (uint64)FMath::Min(A, B))
+		{}
+
+		FORCEINLINE bool operator==(const FEdgeKey& O) const { return Key == O.Key; }
+	};
+
+	// Flat open addressing map from an edge to the vertex created on it, using linear probing. Entries are never removed one by one, 
+	// the whole map is reset between uses while keeping its storage.
+	class FEdgeVertexMap
+	{
+	public:
+		void Reset(int32 ExpectedNum)
+		{
+			const int32 Capacity = (int32)FMath::RoundUpToPowerOfTwo(FMath::Max(16, ExpectedNum * 2));
+			Slots.SetNumUninitialized(Capacity, EAllowShrinking::No);
+			for (FSlot& Slot : Slots)
+				Slot.Key = EmptyKey();
+
+			Mask = Capacity - 1;
+			Num  = 0;
+		}
+
+		// Returns the vertex for the edge, calling CreateVertex if the edge has not been seen before
+		template<typename FuncType>
+		FORCEINLINE int32 FindOrAdd(const FEdgeKey& Edge, FuncType&& CreateVertex)
+		{
+			checkSlow(Edge.Key != EmptyKey());
+
+			if ((Num + 1) * 2 > Slots.Num())
+				Grow();
+
+			for (uint32 Index = HashKey(Edge.Key) & Mask; ; Index = (Index + 1) & Mask)
+			{
+				FSlot& Slot = Slots[Index];
+				if (Slot.Key == Edge.Key)
+					return Slot.Value;
+
+				if (Slot.Key == EmptyKey())
+				{
+					Slot.Key   = Edge.Key;
+					Slot.Value = CreateVertex();
+					++Num;
+					return Slot.Value;
+				}
+			}
+		}
+
+	private:
+		struct FSlot
+		{
+			uint64 Key;
+			int32  Value;
+		};
+
+		static constexpr uint64 EmptyKey() { return MAX_uint64; }
+
+		// Fibonacci hashing, edge keys are two small indices so the upper bits need mixing down
+		static FORCEINLINE uint32 HashKey(uint64 Key) { return (uint32)((Key * 0x9E3779B97F4A7C15ull) >> 32); }
+
+		void Grow()
+		{
+			TArray<FSlot> OldSlots = MoveTemp(Slots);
+			Reset(FMath::Max(Num * 2, 8));
+
+			for (const FSlot& OldSlot : OldSlots)
+			{
+				if (OldSlot.Key == EmptyKey())
+					continue;
+
+				uint32 Index = HashKey(OldSlot.Key) & Mask;
+				while (Slots[Index].Key != EmptyKey())
+					Index = (Index + 1) & Mask;
+
+				Slots[Index] = OldSlot;
+				++Num;
+			}
+		}
+
+		TArray<FSlot> Slots;
+		uint32        Mask = 0;
+		int32         Num  = 0;
+	};
+}
@@ -0,0 +1,104 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#include "WaterPhysicsFrameArena.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/PlatformTLS.h"
+
+namespace WaterPhysicsFrameArena
+{
+	std::atomic<uint64> NextArenaId { 1 };
+
+	// Arena of the innermost scope on this thread
+	thread_local FWaterPhysicsFrameArena* CurrentArena = nullptr;
+};
+
+FWaterPhysicsFrameArena::FScope::FScope(FWaterPhysicsFrameArena* Arena)
+	: PreviousArena(WaterPhysicsFrameArena::CurrentArena)
+{
+	WaterPhysicsFrameArena::CurrentArena = Arena;
+}
+
+FWaterPhysicsFrameArena::FScope::~FScope()
+{
+	WaterPhysicsFrameArena::CurrentArena = PreviousArena;
+}
+
+FWaterPhysicsFrameArena* FWaterPhysicsFrameArena::GetCurrent()
+{
+	return WaterPhysicsFrameArena::CurrentArena;
+}
+
+FWaterPhysicsFrameArena::FWaterPhysicsFrameArena()
+	: ArenaId(WaterPhysicsFrameArena::NextArenaId++)
+{}
+
+FWaterPhysicsFrameArena::~FWaterPhysicsFrameArena()
+{
+	for (const TUniquePtr<FThreadBlocks>& Thread : ThreadBlocks)
+	{
+		for (const FBlock& Block : Thread->Blocks)
+			FMemory::Free(Block.Data);
+	}
+}
+
+void FWaterPhysicsFrameArena::Reset()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ResetFrameArena);
+
+	FScopeLock Lock(&ThreadBlocksCS);
+	for (const TUniquePtr<FThreadBlocks>& Thread : ThreadBlocks)
+	{
+		Thread->CurrentBlock = 0;
+		Thread->BlockOffset  = 0;
+	}
+}
+
+FWaterPhysicsFrameArena::FThreadBlocks& FWaterPhysicsFrameArena::GetThreadBlocks()
+{
+	// A thread mostly allocates from the same arena in a row, only look it up when switching arenas
+	struct FCachedThreadBlocks
+	{
+		uint64         ArenaId = 0;
+		FThreadBlocks* Blocks  = nullptr;
+	};
+	static thread_local FCachedThreadBlocks Cached;
+
+	if (Cached.ArenaId == ArenaId)
+		return *Cached.Blocks;
+
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+	FScopeLock Lock(&ThreadBlocksCS);
+
+	TUniquePtr<FThreadBlocks>* Found = ThreadBlocks.FindByPredicate([ThreadId](const TUniquePtr<FThreadBlocks>& Thread) { return Thread->ThreadId == ThreadId; });
+	FThreadBlocks* Blocks = Found ? Found->Get() : ThreadBlocks.Add_GetRef(MakeUnique<FThreadBlocks>()).Get();
+	Blocks->ThreadId = ThreadId;
+
+	Cached.ArenaId = ArenaId;
+	Cached.Blocks  = Blocks;
+	return *Blocks;
+}
+
+void* FWaterPhysicsFrameArena::Allocate(SIZE_T Size, uint32 Alignment)
+{
+	FThreadBlocks& Thread = GetThreadBlocks();
+
+	// Continue in the current block, skipping to the first following block the allocation fits in
+	for (; Thread.CurrentBlock < Thread.Blocks.Num(); ++Thread.CurrentBlock, Thread.BlockOffset = 0)
+	{
+		const FBlock& Block = Thread.Blocks[Thread.CurrentBlock];
+		const SIZE_T Offset = Align((SIZE_T)(Block.Data + Thread.BlockOffset), Alignment) - (SIZE_T)Block.Data;
+		if (Offset + Size <= Block.Size)
+		{
+			Thread.BlockOffset = Offset + Size;
+			return Block.Data + Offset;
+		}
+	}
+
+	// Only happens until the arena has grown to fit a whole step
+	const SIZE_T NewBlockSize = FMath::Max(BlockSize(), Size);
+	Thread.Blocks.Add(FBlock{ (uint8*)FMemory::Malloc(NewBlockSize, FMath::Max(Alignment, (uint32)DEFAULT_ALIGNMENT)), NewBlockSize });
+	Thread.CurrentBlock = Thread.Blocks.Num() - 1;
+	Thread.BlockOffset  = Size;
+	return Thread.Blocks.Last().Data;
+}
@@ -4,6 +4,11 @@
 
 #include "PhysicsEngine/ConvexElem.h"
 #include "CollisionShape.h"
+#include "Algo/Count.h"
+
+#if PLATFORM_ALWAYS_HAS_AVX_2
+#include <immintrin.h>
+#endif
 
 // NOTE: For now we follow the scaling behaviour of UE4 collision. However, UE4 collision scaling is a bit buggy so it's not optimal.
 
@@ -40,8 +45,7 @@ void TransformSphylElem(FWaterPhysicsCollisionSetup::FSphylElem& SphylElem, cons
 
 void TransformMeshElem(FWaterPhysicsCollisionSetup::FMeshElem& MeshElem, const FTransform& Transform)
 {
-	for (FVector& Vertex : MeshElem.VertexList)
-		Vertex = Transform.TransformPosition(Vertex);
+	MeshElem.Transform = MeshElem.Transform * Transform;
 }
 
 WaterPhysics::FIndexedTriangleMesh ExtractConvexElemTriangles(const struct FKConvexElem& ConvexElem, bool bMirrorX)
@@ -68,4 +72,536 @@ WaterPhysics::FIndexedTriangleMesh ExtractConvexElemTriangles(const struct FKCon
 	}
 
 	return OutMesh;
-}
\ No newline at end of file
+}
+
+namespace WaterPhysicsSimplification
+{
+	// Symmetric 4x4 error quadric (Garland & Heckbert), stored as the upper triangle
+	struct FQuadric
+	{
+		double XX, XY, XZ, XW, YY, YZ, YW, ZZ, ZW, WW;
+
+		explicit FQuadric(EForceInit) { FMemory::Memzero(*this); }
+
+		FQuadric(const FVector& N, double D, double Weight)
+			: XX(N.X * N.X * Weight), XY(N.X * N.Y * Weight), XZ(N.X * N.Z * Weight), XW(N.X * D * Weight)
+			, YY(N.Y * N.Y * Weight), YZ(N.Y * N.Z * Weight), YW(N.Y * D * Weight)
+			, ZZ(N.Z * N.Z * Weight), ZW(N.Z * D * Weight)
+			, WW(D * D * Weight)
+		{}
+
+		FORCEINLINE void operator+=(const FQuadric& O)
+		{
+			XX += O.XX; XY += O.XY; XZ += O.XZ; XW += O.XW; YY += O.YY;
+			YZ += O.YZ; YW += O.YW; ZZ += O.ZZ; ZW += O.ZW; WW += O.WW;
+		}
+
+		FORCEINLINE double Evaluate(const FVector& P) const
+		{
+			return XX * P.X * P.X + 2.0 * XY * P.X * P.Y + 2.0 * XZ * P.X * P.Z + 2.0 * XW * P.X
+				 + YY * P.Y * P.Y + 2.0 * YZ * P.Y * P.Z + 2.0 * YW * P.Y
+				 + ZZ * P.Z * P.Z + 2.0 * ZW * P.Z
+				 + WW;
+		}
+
+		// Finds the position with the smallest error, fails if the quadric is (close to) singular
+		bool Minimize(FVector& OutPosition) const
+		{
+			const double Det = XX * (YY * ZZ - YZ * YZ) - XY * (XY * ZZ - YZ * XZ) + XZ * (XY * YZ - YY * XZ);
+			if (FMath::Abs(Det) < 1e-12)
+				return false;
+
+			const double InvDet = 1.0 / Det;
+			OutPosition.X = -InvDet * (XW * (YY * ZZ - YZ * YZ) - XY * (YW * ZZ - YZ * ZW) + XZ * (YW * YZ - YY * ZW));
+			OutPosition.Y = -InvDet * (XX * (YW * ZZ - ZW * YZ) - XW * (XY * ZZ - YZ * XZ) + XZ * (XY * ZW - YW * XZ));
+			OutPosition.Z = -InvDet * (XX * (YY * ZW - YZ * YW) - XY * (XY * ZW - YW * XZ) + XW * (XY * YZ - YY * XZ));
+			return true;
+		}
+	};
+
+	struct FCollapse
+	{
+		double  Cost;
+		int32   Keep;
+		int32   Remove;
+		uint32  KeepVersion;
+		uint32  RemoveVersion;
+		FVector Target;
+
+		FORCEINLINE bool operator<(const FCollapse& O) const { return Cost < O.Cost; }
+	};
+
+	double CalcSignedVolume(const TArray<FVector>& Positions, const TArray<FIntVector>& Triangles, const TBitArray<>& RemovedTriangles)
+	{
+		double Volume = 0.0;
+		for (int32 i = 0; i < Triangles.Num(); i++)
+		{
+			if (!RemovedTriangles[i])
+				Volume += FVector::DotProduct(Positions[Triangles[i].X], FVector::CrossProduct(Positions[Triangles[i].Y], Positions[Triangles[i].Z]));
+		}
+		return Volume / 6.0;
+	}
+
+	// Centroid of the enclosed volume, the volume weighted centroids of the tetrahedrons formed by each triangle and the origin
+	FVector CalcVolumeCentroid(const TArray<FVector>& Positions, const TArray<FIntVector>& Triangles, const TBitArray<>& RemovedTriangles, double SignedVolume)
+	{
+		FVector WeightedSum = FVector::ZeroVector;
+		for (int32 i = 0; i < Triangles.Num(); i++)
+		{
+			if (RemovedTriangles[i])
+				continue;
+
+			const FVector& A = Positions[Triangles[i].X];
+			const FVector& B = Positions[Triangles[i].Y];
+			const FVector& C = Positions[Triangles[i].Z];
+			WeightedSum += (A + B + C) * (FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 24.0);
+		}
+		return WeightedSum / SignedVolume;
+	}
+}
+
+void SimplifyTriangleMesh(WaterPhysics::FIndexedTriangleMesh& Mesh, int32 MaxTriangles)
+{
+	using namespace WaterPhysicsSimplification;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(SimplifyTriangleMesh);
+
+	if (MaxTriangles <= 0 || Mesh.IndexList.Num() / 3 <= MaxTriangles)
+		return;
+
+	// Weld vertices sharing the same position, render meshes split vertices along UV and normal seams
+	TArray<FVector> Positions;
+	TArray<FIntVector> Triangles;
+	{
+		TMap<FVector, int32> WeldedVertices;
+		TArray<int32> VertexRemap;
+		VertexRemap.SetNumUninitialized(Mesh.VertexList.Num());
+		for (int32 i = 0; i < Mesh.VertexList.Num(); i++)
+		{
+			if (const int32* ExistingVertex = WeldedVertices.Find(Mesh.VertexList[i]))
+				VertexRemap[i] = *ExistingVertex;
+			else
+				VertexRemap[i] = WeldedVertices.Add(Mesh.VertexList[i], Positions.Add(Mesh.VertexList[i]));
+		}
+
+		Triangles.Reserve(Mesh.IndexList.Num() / 3);
+		for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
+		{
+			const FIntVector Triangle(VertexRemap[Mesh.IndexList[i]], VertexRemap[Mesh.IndexList[i + 1]], VertexRemap[Mesh.IndexList[i + 2]]);
+			if (Triangle.X != Triangle.Y && Triangle.Y != Triangle.Z && Triangle.Z != Triangle.X)
+				Triangles.Add(Triangle);
+		}
+	}
+
+	const int32 NumVertices = Positions.Num();
+
+	TBitArray<> RemovedTriangles(false, Triangles.Num());
+	TBitArray<> RemovedVertices(false, NumVertices);
+	TBitArray<> LockedVertices(false, NumVertices);
+	TArray<uint32> VertexVersions;
+	VertexVersions.SetNumZeroed(NumVertices);
+	TArray<TArray<int32, TInlineAllocator<8>>> VertexTriangles;
+	VertexTriangles.SetNum(NumVertices);
+	TArray<FQuadric> Quadrics;
+	Quadrics.Init(FQuadric(ForceInit), NumVertices);
+
+	for (int32 i = 0; i < Triangles.Num(); i++)
+	{
+		const FIntVector& T = Triangles[i];
+		const FVector Cross = FVector::CrossProduct(Positions[T.Y] - Positions[T.X], Positions[T.Z] - Positions[T.X]);
+		const double  Area  = Cross.Size() * 0.5;
+		const FVector Normal = Cross.GetSafeNormal();
+		const FQuadric Quadric(Normal, -FVector::DotProduct(Normal, Positions[T.X]), Area);
+
+		for (int32 j = 0; j < 3; j++)
+		{
+			Quadrics[T[j]] += Quadric;
+			VertexTriangles[T[j]].Add(i);
+		}
+	}
+
+	// Lock vertices on open or non-manifold edges, collapsing them would tear or shrink the surface
+	TMap<uint64, int32> EdgeTriangleCount;
+	for (const FIntVector& T : Triangles)
+	{
+		for (int32 j = 0; j < 3; j++)
+		{
+			const uint32 A = T[j], B = T[(j + 1) % 3];
+			EdgeTriangleCount.FindOrAdd(((uint64)FMath::Max(A, B) << 32) | FMath::Min(A, B))++;
+		}
+	}
+
+	bool bClosedMesh = true;
+	for (const TPair<uint64, int32>& Edge : EdgeTriangleCount)
+	{
+		if (Edge.Value != 2)
+		{
+			LockedVertices[(int32)(Edge.Key >> 32)] = true;
+			LockedVertices[(int32)(Edge.Key & 0xFFFFFFFF)] = true;
+			bClosedMesh = false;
+		}
+	}
+
+	const double SourceVolume = bClosedMesh ? CalcSignedVolume(Positions, Triangles, RemovedTriangles) : 0.0;
+
+	TArray<FCollapse> CollapseHeap;
+
+	const auto PushCollapse = [&](int32 A, int32 B)
+	{
+		if (LockedVertices[A] && LockedVertices[B])
+			return;
+
+		// Always keep the locked vertex in place
+		if (LockedVertices[A])
+			Swap(A, B);
+
+		FQuadric Quadric = Quadrics[A];
+		Quadric += Quadrics[B];
+
+		FCollapse Collapse;
+		Collapse.Keep          = B;
+		Collapse.Remove        = A;
+		Collapse.KeepVersion   = VertexVersions[B];
+		Collapse.RemoveVersion = VertexVersions[A];
+
+		if (LockedVertices[B] || !Quadric.Minimize(Collapse.Target))
+		{
+			const FVector Candidates[3] = { Positions[B], Positions[A], (Positions[A] + Positions[B]) * 0.5 };
+			const int32 NumCandidates = LockedVertices[B] ? 1 : 3;
+
+			Collapse.Target = Candidates[0];
+			for (int32 i = 1; i < NumCandidates; i++)
+			{
+				if (Quadric.Evaluate(Candidates[i]) < Quadric.Evaluate(Collapse.Target))
+					Collapse.Target = Candidates[i];
+			}
+		}
+
+		Collapse.Cost = Quadric.Evaluate(Collapse.Target);
+		CollapseHeap.HeapPush(Collapse);
+	};
+
+	for (const TPair<uint64, int32>& Edge : EdgeTriangleCount)
+		PushCollapse((int32)(Edge.Key >> 32), (int32)(Edge.Key & 0xFFFFFFFF));
+
+	const auto GatherNeighbours = [&](int32 Vertex, TArray<int32, TInlineAllocator<16>>& OutNeighbours)
+	{
+		OutNeighbours.Reset();
+		for (int32 TriangleIndex : VertexTriangles[Vertex])
+		{
+			if (RemovedTriangles[TriangleIndex])
+				continue;
+
+			for (int32 j = 0; j < 3; j++)
+			{
+				if (Triangles[TriangleIndex][j] != Vertex)
+					OutNeighbours.AddUnique(Triangles[TriangleIndex][j]);
+			}
+		}
+	};
+
+	// Rejects collapses which would flip or degenerate any of the triangles around the moved vertex
+	const auto CausesFlip = [&](int32 Vertex, int32 OtherVertex, const FVector& Target)
+	{
+		for (int32 TriangleIndex : VertexTriangles[Vertex])
+		{
+			const FIntVector& T = Triangles[TriangleIndex];
+			if (RemovedTriangles[TriangleIndex] || T.X == OtherVertex || T.Y == OtherVertex || T.Z == OtherVertex)
+				continue;
+
+			FVector Corners[3] = { Positions[T.X], Positions[T.Y], Positions[T.Z] };
+			const FVector OldNormal = CalcTriangleNormal(Corners);
+			for (int32 j = 0; j < 3; j++)
+			{
+				if (T[j] == Vertex)
+					Corners[j] = Target;
+			}
+
+			const FVector NewNormal = CalcTriangleNormal(Corners);
+			if (NewNormal.IsNearlyZero() || FVector::DotProduct(OldNormal, NewNormal) < 0.2f)
+				return true;
+		}
+		return false;
+	};
+
+	int32 NumTriangles = Triangles.Num();
+	TArray<int32, TInlineAllocator<16>> KeepNeighbours, RemoveNeighbours;
+
+	while (NumTriangles > MaxTriangles && CollapseHeap.Num() > 0)
+	{
+		FCollapse Collapse;
+		CollapseHeap.HeapPop(Collapse, EAllowShrinking::No);
+
+		const int32 Keep   = Collapse.Keep;
+		const int32 Remove = Collapse.Remove;
+
+		// Stale entry, one of the vertices has changed since this collapse was evaluated
+		if (RemovedVertices[Keep] || RemovedVertices[Remove] 
+			|| VertexVersions[Keep] != Collapse.KeepVersion || VertexVersions[Remove] != Collapse.RemoveVersion)
+			continue;
+
+		// Link condition: the two vertices may only share the two vertices opposite to the edge, otherwise the collapse is non-manifold
+		GatherNeighbours(Keep, KeepNeighbours);
+		GatherNeighbours(Remove, RemoveNeighbours);
+		if (Algo::CountIf(RemoveNeighbours, [&](int32 V) { return KeepNeighbours.Contains(V); }) != 2)
+			continue;
+
+		if (CausesFlip(Keep, Remove, Collapse.Target) || CausesFlip(Remove, Keep, Collapse.Target))
+			continue;
+
+		Positions[Keep] = Collapse.Target;
+		Quadrics[Keep] += Quadrics[Remove];
+		RemovedVertices[Remove] = true;
+		VertexVersions[Keep]++;
+
+		for (int32 TriangleIndex : VertexTriangles[Remove])
+		{
+			if (RemovedTriangles[TriangleIndex])
+				continue;
+
+			FIntVector& T = Triangles[TriangleIndex];
+			if (T.X == Keep || T.Y == Keep || T.Z == Keep)
+			{
+				RemovedTriangles[TriangleIndex] = true;
+				NumTriangles--;
+				continue;
+			}
+
+			for (int32 j = 0; j < 3; j++)
+			{
+				if (T[j] == Remove)
+					T[j] = Keep;
+			}
+			VertexTriangles[Keep].Add(TriangleIndex);
+		}
+		VertexTriangles[Remove].Empty();
+		VertexTriangles[Keep].RemoveAll([&](int32 TriangleIndex) { return RemovedTriangles[TriangleIndex]; });
+
+		// Re-evaluate the collapse cost of all edges around the moved vertex, the old entries are invalidated by the version bump above
+		GatherNeighbours(Keep, KeepNeighbours);
+		for (int32 Neighbour : KeepNeighbours)
+			PushCollapse(Keep, Neighbour);
+	}
+
+	// QEM keeps the shape but tends to lose some volume on curved surfaces, scale the result back to the source volume
+	if (bClosedMesh && SourceVolume != 0.0)
+	{
+		const double SimplifiedVolume = CalcSignedVolume(Positions, Triangles, RemovedTriangles);
+		if (SimplifiedVolume != 0.0 && FMath::Sign(SimplifiedVolume) == FMath::Sign(SourceVolume))
+		{
+			// Scaling about the volume centroid keeps it in place, the vertex average is pulled towards densely triangulated areas
+			const FVector Centroid = CalcVolumeCentroid(Positions, Triangles, RemovedTriangles, SimplifiedVolume);
+
+			const double Scale = FMath::Pow(SourceVolume / SimplifiedVolume, 1.0 / 3.0);
+			for (int32 i = 0; i < NumVertices; i++)
+				Positions[i] = Centroid + (Positions[i] - Centroid) * Scale;
+		}
+	}
+
+	// Write back the remaining triangles, dropping removed vertices
+	TArray<int32> VertexRemap;
+	VertexRemap.Init(INDEX_NONE, NumVertices);
+
+	Mesh.VertexList.Reset();
+	Mesh.IndexList.Reset();
+	for (int32 i = 0; i < Triangles.Num(); i++)
+	{
+		if (RemovedTriangles[i])
+			continue;
+
+		for (int32 j = 0; j < 3; j++)
+		{
+			int32& Index = VertexRemap[Triangles[i][j]];
+			if (Index == INDEX_NONE)
+				Index = Mesh.VertexList.Add(Positions[Triangles[i][j]]);
+			Mesh.IndexList.Add(Index);
+		}
+	}
+}
+
+FSubmergedVolume CalcSphereSubmergedVolume(const FVector& Center, float Radius, const FPlane& WaterPlane)
+{
+	FSubmergedVolume Result;
+
+	// Spherical cap with height H below the water plane
+	const float H = FMath::Clamp(Radius - (float)WaterPlane.PlaneDot(Center), 0.f, 2.f * Radius);
+	if (H <= 0.f)
+		return Result;
+
+	Result.Volume   = PI * H * H * (3.f * Radius - H) / 3.f;
+	Result.Centroid = Center - WaterPlane.GetNormal() * (3.f * FMath::Square(2.f * Radius - H) / (4.f * (3.f * Radius - H)));
+	return Result;
+}
+
+FSubmergedVolume CalcBoxSubmergedVolume(const FVector& Center, const FQuat& Rotation, const FVector& HalfExtent, const FPlane& WaterPlane)
+{
+	FSubmergedVolume Result;
+
+	const FVector Axes[3] = { Rotation.GetAxisX() * HalfExtent.X, Rotation.GetAxisY() * HalfExtent.Y, Rotation.GetAxisZ() * HalfExtent.Z };
+
+	// Early out for boxes which are completely dry or submerged
+	const float CenterDistance = WaterPlane.PlaneDot(Center);
+	const float ProjectedExtent = FMath::Abs(FVector::DotProduct(Axes[0], WaterPlane.GetNormal())) 
+		+ FMath::Abs(FVector::DotProduct(Axes[1], WaterPlane.GetNormal())) 
+		+ FMath::Abs(FVector::DotProduct(Axes[2], WaterPlane.GetNormal()));
+
+	if (CenterDistance >= ProjectedExtent)
+		return Result;
+
+	if (CenterDistance <= -ProjectedExtent)
+	{
+		Result.Volume   = 8.f * HalfExtent.X * HalfExtent.Y * HalfExtent.Z;
+		Result.Centroid = Center;
+		return Result;
+	}
+
+	// Clip each face against the water plane and integrate the volume of the remaining polyhedron with the divergence theorem.
+	// The tetrahedrons are formed against a point on the water plane, which makes the contribution of the (missing) waterline cap face zero.
+	const FVector Origin = Center - WaterPlane.GetNormal() * CenterDistance;
+
+	double  TotalVolume   = 0.0;
+	FVector TotalCentroid = FVector::ZeroVector;
+
+	TArray<FVector, TInlineAllocator<8>> Face, ClippedFace;
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		for (const float Side : { -1.f, 1.f })
+		{
+			const FVector FaceCenter = Center + Axes[Axis] * Side;
+			const FVector U = Axes[(Axis + 1) % 3];
+			const FVector V = Axes[(Axis + 2) % 3] * Side; // Flip winding on the negative side to keep all faces facing outwards
+
+			Face = { FaceCenter - U - V, FaceCenter + U - V, FaceCenter + U + V, FaceCenter - U + V };
+
+			ClippedFace.Reset();
+			for (int32 i = 0; i < Face.Num(); i++)
+			{
+				const FVector& P0 = Face[i];
+				const FVector& P1 = Face[(i + 1) % Face.Num()];
+				const float D0 = WaterPlane.PlaneDot(P0);
+				const float D1 = WaterPlane.PlaneDot(P1);
+
+				if (D0 <= 0.f)
+					ClippedFace.Add(P0);
+				if ((D0 < 0.f && D1 > 0.f) || (D0 > 0.f && D1 < 0.f))
+					ClippedFace.Add(FMath::Lerp(P0, P1, D0 / (D0 - D1)));
+			}
+
+			for (int32 i = 1; i + 1 < ClippedFace.Num(); i++)
+			{
+				const FVector A = ClippedFace[0] - Origin;
+				const FVector B = ClippedFace[i] - Origin;
+				const FVector C = ClippedFace[i + 1] - Origin;
+				const double TetVolume = FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 6.0;
+
+				TotalVolume   += TetVolume;
+				TotalCentroid += (Origin + (A + B + C) * 0.25) * TetVolume;
+			}
+		}
+	}
+
+	if (FMath::Abs(TotalVolume) > UE_SMALL_NUMBER)
+	{
+		Result.Volume   = FMath::Abs(TotalVolume);
+		Result.Centroid = TotalCentroid / TotalVolume;
+	}
+
+	return Result;
+}
+
+FSubmergedVolume CalcCapsuleSubmergedVolume(const FVector& Center, const FVector& Axis, float HalfHeight, float Radius, const FPlane& WaterPlane)
+{
+	FSubmergedVolume Result;
+
+	// Cut by a tilted plane the capsule has no convenient closed form, instead integrate it as slices along the axis.
+	// Each slice is a disc where the submerged part is a circular segment, which does have a closed form.
+	constexpr int32 NumSlices = 32;
+
+	const FVector WaterNormal    = WaterPlane.GetNormal();
+	const FVector InPlaneNormal  = WaterNormal - Axis * FVector::DotProduct(WaterNormal, Axis);
+	const float   InPlaneSlope   = InPlaneNormal.Size();
+	const FVector SegmentDir     = InPlaneSlope > UE_KINDA_SMALL_NUMBER ? -InPlaneNormal / InPlaneSlope : FVector::ZeroVector;
+	const float   TotalHalfHeight = HalfHeight + Radius;
+	const float   SliceThickness  = 2.f * TotalHalfHeight / NumSlices;
+
+	for (int32 i = 0; i < NumSlices; i++)
+	{
+		const float   S           = -TotalHalfHeight + (i + 0.5f) * SliceThickness;
+		const float   CapDistance = FMath::Abs(S) - HalfHeight;
+		const float   SliceRadius = CapDistance > 0.f ? FMath::Sqrt(FMath::Max(0.f, Radius * Radius - CapDistance * CapDistance)) : Radius;
+		const FVector SliceCenter = Center + Axis * S;
+		const float   SliceHeight = WaterPlane.PlaneDot(SliceCenter);
+
+		// Distance from the slice center to the waterline chord, in the plane of the slice
+		const float ChordDistance = InPlaneSlope > UE_KINDA_SMALL_NUMBER 
+			? SliceHeight / InPlaneSlope 
+			: (SliceHeight < 0.f ? -BIG_NUMBER : BIG_NUMBER);
+
+		float SegmentArea;
+		float SegmentCentroid;
+		if (ChordDistance >= SliceRadius)
+		{
+			continue;
+		}
+		else if (ChordDistance <= -SliceRadius)
+		{
+			SegmentArea     = PI * SliceRadius * SliceRadius;
+			SegmentCentroid = 0.f;
+		}
+		else
+		{
+			const float HalfChordSquared = SliceRadius * SliceRadius - ChordDistance * ChordDistance;
+			SegmentArea     = SliceRadius * SliceRadius * FMath::Acos(ChordDistance / SliceRadius) - ChordDistance * FMath::Sqrt(HalfChordSquared);
+			SegmentCentroid = SegmentArea > UE_SMALL_NUMBER ? (2.f / 3.f) * HalfChordSquared * FMath::Sqrt(HalfChordSquared) / SegmentArea : 0.f;
+		}
+
+		FSubmergedVolume Slice;
+		Slice.Volume   = SegmentArea * SliceThickness;
+		Slice.Centroid = SliceCenter + SegmentDir * SegmentCentroid;
+		Result += Slice;
+	}
+
+	return Result;
+}
+
+void CalcVertexWaterDepths(const float* VertexX, const float* VertexY, const float* VertexZ, const float* NormalX, const float* NormalY, 
+	const float* NormalZ, const float* PlaneW, int32 Num, float* OutDepths, uint32* OutSubmergedMask)
+{
+	FMemory::Memzero(OutSubmergedMask, FMath::DivideAndRoundUp(Num, 32) * sizeof(uint32));
+
+	int32 i = 0;
+
+#if PLATFORM_ALWAYS_HAS_AVX_2
+	// Eight vertices at a time, a group of eight never straddles two mask words
+	const __m256 Zero8 = _mm256_setzero_ps();
+	for (; i + 8 <= Num; i += 8)
+	{
+		__m256 Depth = _mm256_mul_ps(_mm256_loadu_ps(VertexX + i), _mm256_loadu_ps(NormalX + i));
+		Depth = _mm256_add_ps(Depth, _mm256_mul_ps(_mm256_loadu_ps(VertexY + i), _mm256_loadu_ps(NormalY + i)));
+		Depth = _mm256_add_ps(Depth, _mm256_mul_ps(_mm256_loadu_ps(VertexZ + i), _mm256_loadu_ps(NormalZ + i)));
+		Depth = _mm256_sub_ps(Depth, _mm256_loadu_ps(PlaneW + i));
+
+		_mm256_storeu_ps(OutDepths + i, Depth);
+		OutSubmergedMask[i >> 5] |= (uint32)_mm256_movemask_ps(_mm256_cmp_ps(Depth, Zero8, _CMP_LT_OQ)) << (i & 31);
+	}
+#endif
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	for (; i + 4 <= Num; i += 4)
+	{
+		VectorRegister4Float Depth = VectorMultiply(VectorLoad(VertexX + i), VectorLoad(NormalX + i));
+		Depth = VectorMultiplyAdd(VectorLoad(VertexY + i), VectorLoad(NormalY + i), Depth);
+		Depth = VectorMultiplyAdd(VectorLoad(VertexZ + i), VectorLoad(NormalZ + i), Depth);
+		Depth = VectorSubtract(Depth, VectorLoad(PlaneW + i));
+
+		VectorStore(Depth, OutDepths + i);
+		OutSubmergedMask[i >> 5] |= (uint32)VectorMaskBits(VectorCompareLT(Depth, Zero)) << (i & 31);
+	}
+
+	for (; i < Num; ++i)
+	{
+		OutDepths[i] = VertexX[i] * NormalX[i] + VertexY[i] * NormalY[i] + VertexZ[i] * NormalZ[i] - PlaneW[i];
+		if (OutDepths[i] < 0.f)
+			OutSubmergedMask[i >> 5] |= 1u << (i & 31);
+	}
+}
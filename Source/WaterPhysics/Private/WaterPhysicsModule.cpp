@@ -2,6 +2,7 @@
 
 #include "WaterPhysicsModule.h"
 #include "Modules/ModuleManager.h"
+#include "WaterPhysicsTypes.h"
 
 DEFINE_LOG_CATEGORY(LogWaterPhysics);
 
@@ -11,6 +12,8 @@ static FName RiverologyIntegrationModuleName = TEXT("RiverologyIntegration");
 
 void FWaterPhysicsModule::StartupModule()
 {
+	FWaterPhysicsSettings::CheckMergedSettings();
+
 	// IMPORTANT: This assumes the Water module is loaded before us,
 	// right now the water module is loaded in PostConfigInit, which is before us.
 	if (FModuleManager::Get().IsModuleLoaded(TEXT("Water")))
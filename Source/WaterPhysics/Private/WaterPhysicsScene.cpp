@@ -4,6 +4,7 @@
 #include "WaterPhysicsModule.h"
 #include "WaterPhysicsMath.h"
 #include "WaterPhysicsCollisionInterface.h"
+#include "WaterPhysicsEdgeVertexMap.h"
 #include "WaterPhysicsDebug/WaterPhysicsDebugHelpers.h"
 #include "WaterPhysicsDebug/WaterPhysicsDataProfiler.h"
 
@@ -19,36 +20,30 @@
 #include "PhysicsEngine/BodySetup.h"
 
 #include "Async/ParallelFor.h"
+#include "Algo/AllOf.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/Crc.h"
+
+// Evaluate the per triangle forces with the scalar loops instead of the SIMD kernels. The kernels work in float precision and approximate 
+// FMath::Pow, enable this to get results which are bit identical to earlier versions. Forced on when capturing per triangle forces.
+#ifndef WATER_PHYS_SCALAR_FORCE_KERNELS
+#define WATER_PHYS_SCALAR_FORCE_KERNELS WITH_DEBUG_FORCE_CAPTURE
+#endif
 
 namespace WaterPhysics
 {
-	// Optimized structure for edge lookups with pre-computed hash
-	struct FEdgeKey
-	{
-		uint64 Key;
-		int32 Hash;
-
-		FEdgeKey() = default;
-
-		explicit FEdgeKey(uint32 A, uint32 B)
-			: Key(((uint64)FMath::Max(A, B) << 32) | (uint64)FMath::Min(A, B))
-			, Hash(::GetTypeHash(Key))
-		{}
-
-		FORCEINLINE friend uint32 GetTypeHash(const FEdgeKey& O) { return O.Hash; }
-		FORCEINLINE bool operator==(const FEdgeKey& O) const { return Key == O.Key; }
-	};
-
 	template<typename TTriangleArray> int32 NumTriangles(TTriangleArray& TriangleArray);
 	template<typename TTriangleArray> int32* GetIndices(TTriangleArray& TriangleArray, int32 TriangleIndex);
 	template<typename TTriangleArray> FVector& GetVertex(TTriangleArray& TriangleArray, int32 TriangleIndex, int32 VertexIndex);
 	template<typename TTriangleArray> int32 SplitEdge(TTriangleArray& TriangleArray, int32 IndexA, int32 IndexB);
 	template<typename TTriangleArray> int32 AddTriangle(TTriangleArray& TriangleArray, int32 TriangleIndex, int32 IndexA, int32 IndexB, int32 IndexC);
+	template<typename TTriangleArray> float GetMinDepth(TTriangleArray& TriangleArray, int32 TriangleIndex);
 
-	template<> FORCEINLINE int32 NumTriangles<FSubmergedTriangleArray>(FSubmergedTriangleArray& TriangleArray) { return TriangleArray.TriangleList.Num(); }
+	template<typename FVec> FORCEINLINE int32 NumTriangles(TSubmergedTriangleArray<FVec>& TriangleArray) { return TriangleArray.TriangleList.Num(); }
 	template<> FORCEINLINE int32 NumTriangles<FIndexedTriangleMesh>(FIndexedTriangleMesh& TriangleArray) { return TriangleArray.IndexList.Num() / 3; }
 
-	template<> FORCEINLINE int32* GetIndices<FSubmergedTriangleArray>(FSubmergedTriangleArray& TriangleArray, int32 TriangleIndex) 
+	template<typename FVec> FORCEINLINE int32* GetIndices(TSubmergedTriangleArray<FVec>& TriangleArray, int32 TriangleIndex) 
 	{
 		return &TriangleArray.TriangleList[TriangleIndex].Indices[0];
 	}
@@ -57,7 +52,7 @@ namespace WaterPhysics
 		return &TriangleArray.IndexList[TriangleIndex * 3];
 	}
 
-	template<> FORCEINLINE FVector& GetVertex<FSubmergedTriangleArray>(FSubmergedTriangleArray& TriangleArray, int32 TriangleIndex, int32 VertexIndex)
+	template<typename FVec> FORCEINLINE FVec& GetVertex(TSubmergedTriangleArray<FVec>& TriangleArray, int32 TriangleIndex, int32 VertexIndex)
 	{
 		return TriangleArray.VertexList[TriangleArray.TriangleList[TriangleIndex].Indices[VertexIndex]].Position;
 	}
@@ -66,13 +61,22 @@ namespace WaterPhysics
 		return TriangleArray.VertexList[TriangleArray.IndexList[(TriangleIndex * 3) + VertexIndex]];
 	}
 
-	template<> FORCEINLINE int32 SplitEdge<FSubmergedTriangleArray>(FSubmergedTriangleArray& TriangleArray, int32 IndexA, int32 IndexB)
+	template<typename FVec> FORCEINLINE int32 SplitEdge(TSubmergedTriangleArray<FVec>& TriangleArray, int32 IndexA, int32 IndexB)
 	{
-		return TriangleArray.VertexList.Add(FSubmergedTriangleArray::FVertex
+		const typename TSubmergedTriangleArray<FVec>::FVertex& A = TriangleArray.VertexList[IndexA];
+		const typename TSubmergedTriangleArray<FVec>::FVertex& B = TriangleArray.VertexList[IndexB];
+
+		// Interpolate the water surface rather than the depth, so a curved surface between the samples is picked up by the new vertex
+		const FVec Position        = (A.Position + B.Position) / 2.f;
+		const FVec SurfaceLocation = ((A.Position + A.WaterSurfaceNormal * A.Depth) + (B.Position + B.WaterSurfaceNormal * B.Depth)) / 2.f;
+		const FVec SurfaceNormal   = (A.WaterSurfaceNormal + B.WaterSurfaceNormal).GetSafeNormal(UE_SMALL_NUMBER, A.WaterSurfaceNormal);
+
+		return TriangleArray.VertexList.Add(typename TSubmergedTriangleArray<FVec>::FVertex
 		{
-			(TriangleArray.VertexList[IndexA].Position + TriangleArray.VertexList[IndexB].Position) / 2.f,
-			(TriangleArray.VertexList[IndexA].WaterVelocity + TriangleArray.VertexList[IndexB].WaterVelocity) / 2.f,
-			(TriangleArray.VertexList[IndexA].Depth + TriangleArray.VertexList[IndexB].Depth) / 2.f
+			Position,
+			(A.WaterVelocity + B.WaterVelocity) / 2.f,
+			FMath::Max(0.f, (float)FVec::DotProduct(SurfaceLocation - Position, SurfaceNormal)),
+			SurfaceNormal
 		});
 	}
 	template<> FORCEINLINE int32 SplitEdge<FIndexedTriangleMesh>(FIndexedTriangleMesh& TriangleArray, int32 IndexA, int32 IndexB)
@@ -80,9 +84,9 @@ namespace WaterPhysics
 		return TriangleArray.VertexList.Add((TriangleArray.VertexList[IndexA] + TriangleArray.VertexList[IndexB]) / 2.f);
 	}
 
-	template<> FORCEINLINE int32 AddTriangle<FSubmergedTriangleArray>(FSubmergedTriangleArray& TriangleArray, int32 TriangleIndex, int32 IndexA, int32 IndexB, int32 IndexC)
+	template<typename FVec> FORCEINLINE int32 AddTriangle(TSubmergedTriangleArray<FVec>& TriangleArray, int32 TriangleIndex, int32 IndexA, int32 IndexB, int32 IndexC)
 	{
-		return TriangleArray.EmplaceTriangle(FSubmergedTriangleArray::FTriangle
+		return TriangleArray.EmplaceTriangle(FSubmergedTriangle
 		{
 			{ IndexA, IndexB, IndexC }, 
 			TriangleArray.TriangleList[TriangleIndex].OriginalTriangleIndex 
@@ -94,6 +98,16 @@ namespace WaterPhysics
 		return (TriangleArray.IndexList.Num() - 1) / 3;
 	}
 
+	template<typename FVec> FORCEINLINE float GetMinDepth(TSubmergedTriangleArray<FVec>& TriangleArray, int32 TriangleIndex)
+	{
+		const int32* Indices = TriangleArray.TriangleList[TriangleIndex].Indices;
+		return FMath::Min3(TriangleArray.VertexList[Indices[0]].Depth, TriangleArray.VertexList[Indices[1]].Depth, TriangleArray.VertexList[Indices[2]].Depth);
+	}
+	template<> FORCEINLINE float GetMinDepth<FIndexedTriangleMesh>(FIndexedTriangleMesh& TriangleArray, int32 TriangleIndex)
+	{
+		return 0.f; // No water information, treat every triangle as being at the waterline
+	}
+
 	template<typename TTriangleArray>
 	void TessellateTriangles(TTriangleArray& TriangleArray, const FTessellationSettings& TessellationSettings)
 	{
@@ -101,7 +115,9 @@ namespace WaterPhysics
 
 		struct Local
 		{
-			static TArray<int32, TInlineAllocator<3>> TesselateTriangle(TTriangleArray& TriangleArray, int32 Index, TMap<FEdgeKey, int32>& EdgeSplitVertices)
+			typedef std::remove_reference_t<decltype(GetVertex(std::declval<TTriangleArray&>(), 0, 0))> FVec;
+
+			static TArray<int32, TInlineAllocator<3>> TesselateTriangle(TTriangleArray& TriangleArray, int32 Index, FEdgeVertexMap& EdgeSplitVertices)
 			{
 				// Algorithm
 				// a
@@ -113,7 +129,7 @@ namespace WaterPhysics
 				// take largest one, create vertex in the middle (d)
 				// split the triangle from a to d (a = corner adjacent to line b-c)
 
-				const FVector Vertices[3] = { 
+				const FVec Vertices[3] = { 
 					GetVertex(TriangleArray, Index, 0), 
 					GetVertex(TriangleArray, Index, 1), 
 					GetVertex(TriangleArray, Index, 2) 
@@ -129,13 +145,7 @@ namespace WaterPhysics
 				const int32 BI = GetIndices(TriangleArray, Index)[H.B];
 				const int32 CI = GetIndices(TriangleArray, Index)[(H.B + 1) % 3];
 
-				const FEdgeKey EdgeIndex(AI, BI);
-
-				int32* ExistingVertexIndex = EdgeSplitVertices.Find(EdgeIndex);
-				if (!ExistingVertexIndex)
-					ExistingVertexIndex = &EdgeSplitVertices.Add(EdgeIndex, SplitEdge(TriangleArray, AI, BI));
-
-				const int32 DI = *ExistingVertexIndex;
+				const int32 DI = EdgeSplitVertices.FindOrAdd(FEdgeKey(AI, BI), [&]() { return SplitEdge(TriangleArray, AI, BI); });
 
 				// Overwrite current with one of the split triangles
 				GetIndices(TriangleArray, Index)[0] = DI;
@@ -148,11 +158,20 @@ namespace WaterPhysics
 				return { Index, NewTriangle };
 			}
 
-			static void TesselateTriangle_Recursive(TTriangleArray& TriangleArray, const FTessellationSettings& TessellationSettings, int32 Index, TMap<FEdgeKey, int32>& AreaSplitMap)
+			static float CalcMaxArea(TTriangleArray& TriangleArray, const FTessellationSettings& TessellationSettings, int32 Index)
+			{
+				if (TessellationSettings.TessellationMode != EWaterPhysicsTessellationMode::Waterline || GetMinDepth(TriangleArray, Index) < TessellationSettings.WaterlineBand)
+					return TessellationSettings.MaxArea;
+
+				return TessellationSettings.MaxAreaOutsideWaterline > 0.f ? FMath::Max(TessellationSettings.MaxAreaOutsideWaterline, 0.01f) : 0.f;
+			}
+
+			static void TesselateTriangle_Recursive(TTriangleArray& TriangleArray, const FTessellationSettings& TessellationSettings, int32 Index, FEdgeVertexMap& AreaSplitMap)
 			{
-				const FVector Vertices[3] = { GetVertex(TriangleArray, Index, 0), GetVertex(TriangleArray, Index, 1), GetVertex(TriangleArray, Index, 2) };
+				const FVec Vertices[3] = { GetVertex(TriangleArray, Index, 0), GetVertex(TriangleArray, Index, 1), GetVertex(TriangleArray, Index, 2) };
 				const float TriangleArea = CalcTriangleAreaM2(Vertices);
-				if (TriangleArea > TessellationSettings.MaxArea)
+				const float MaxArea      = CalcMaxArea(TriangleArray, TessellationSettings, Index);
+				if (MaxArea > 0.f && TriangleArea > MaxArea)
 				{
 					const auto NewTriangles = TesselateTriangle(TriangleArray, Index, AreaSplitMap);
 					for (int32 i = 0; i < NewTriangles.Num(); i++)
@@ -163,7 +182,8 @@ namespace WaterPhysics
 			}
 		};
 
-		TMap<FEdgeKey, int32> EdgeSplitVertices;
+		static thread_local FEdgeVertexMap EdgeSplitVertices;
+		EdgeSplitVertices.Reset(NumTriangles(TriangleArray) * 2);
 
 		switch (TessellationSettings.TessellationMode)
 		{
@@ -178,6 +198,7 @@ namespace WaterPhysics
 			break;
 		}
 		case EWaterPhysicsTessellationMode::Area:
+		case EWaterPhysicsTessellationMode::Waterline:
 		{
 			const int32 NrTriangles = NumTriangles(TriangleArray);
 			for (int32 i = 0; i < NrTriangles; i++)
@@ -228,31 +249,55 @@ namespace WaterPhysics
 		return BoxTriangleMesh;
 	}
 
-	FIndexedTriangleMesh TriangulateSphereElem(float SphereRadius, const FVector& SphereCenter, int32 Subdivisions)
+	// Unit icosphere with its subdivision pre-computed, shared by all sphere triangulations
+	struct FIcoMeshTemplate
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateSphereElem);
+		FVertexList VertexList;
+		FIndexList  IndexList;
+	};
+
+	// Unit icosphere cut in two along its outline seen from above, the triangles facing up make up the top half, bridged by 
+	// quads along the cut. Moving the halves apart sweeps the sphere along the capsule segment, which unlike stretching 
+	// a sphere stays convex for any proportions, so that capsules can occlude other collision elements.
+	struct FIcoCapsuleTemplate
+	{
+		FVertexList  VertexList;
+		FIndexList   IndexList;
+		TArray<int8> HalfHeightSigns; // 1 for the vertices of the top half, -1 for the bottom half
+	};
+
+	// The highest subdivision level for which templates are cached, higher levels are built on demand
+	static constexpr int32 MaxCachedIcoMeshSubdivisions() { return 5; }
+
+	FIcoMeshTemplate BuildIcoMeshTemplate(const FVertexList& BaseVertices, const FIndexList& BaseIndices, int32 Subdivisions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuildIcoMeshTemplate);
+
+		FIcoMeshTemplate Template;
+		Template.VertexList = BaseVertices;
+		Template.IndexList  = BaseIndices;
 
-		const static auto SubdivideIcoSphere = [](FIndexedTriangleMesh& InIcoSphere)
+		for (int32 Level = 0; Level < Subdivisions; ++Level)
 		{
-			TMap<FEdgeKey, int32> EdgeLookup;
-			EdgeLookup.Reserve(InIcoSphere.IndexList.Num());
+			FEdgeVertexMap EdgeLookup;
+			EdgeLookup.Reset(Template.IndexList.Num() / 2);
 
 			FIndexList NewIndexList;
-			NewIndexList.Reserve(InIcoSphere.IndexList.Num() * 3);
+			NewIndexList.Reserve(Template.IndexList.Num() * 4);
 
 			const auto VertexForEdge = [&](int32 First, int32 Second)->int32
 			{
-				const FEdgeKey Key(First, Second);
-				if (const auto* Index = EdgeLookup.Find(Key))
-					return *Index;
-
-				return EdgeLookup.Add(Key, InIcoSphere.VertexList.Add((InIcoSphere.VertexList[First] + InIcoSphere.VertexList[Second]).GetSafeNormal()));
+				return EdgeLookup.FindOrAdd(FEdgeKey(First, Second), [&]()
+				{
+					const FVector MidPoint = (Template.VertexList[First] + Template.VertexList[Second]) / 2.f;
+					return Template.VertexList.Add(MidPoint.GetSafeNormal());
+				});
 			};
 
-			for (int32 i = 0; i < InIcoSphere.IndexList.Num(); i += 3)
+			for (int32 i = 0; i < Template.IndexList.Num(); i += 3)
 			{
-				const int32* Indices = &InIcoSphere.IndexList[i];
-				const int32  Mid[3] = {
+				const int32 Indices[3] = { Template.IndexList[i], Template.IndexList[i + 1], Template.IndexList[i + 2] };
+				const int32 Mid[3] = {
 					VertexForEdge(Indices[0], Indices[1]),
 					VertexForEdge(Indices[1], Indices[2]),
 					VertexForEdge(Indices[2], Indices[0])
@@ -267,9 +312,14 @@ namespace WaterPhysics
 				});
 			}
 
-			InIcoSphere.IndexList = NewIndexList;
-		};
+			Template.IndexList = MoveTemp(NewIndexList);
+		}
+
+		return Template;
+	}
 
+	const FIcoMeshTemplate& GetIcoSphereTemplate(int32 Subdivisions, TOptional<FIcoMeshTemplate>& UncachedTemplate)
+	{
 		const static FVertexList UnitIcoSphereVertices = 
 		{
 			FVector( 0.000000,  0.000000, -1.000000),
@@ -295,701 +345,2542 @@ namespace WaterPhysics
 			7,6,11, 8,7,11, 9,8,11, 10,9,11
 		};
 
-		FIndexedTriangleMesh IcoSphere = { UnitIcoSphereVertices, UnitIcoSphereIndices };
-
-		for (int32 i = 0; i < Subdivisions; ++i)
-			SubdivideIcoSphere(IcoSphere);
+		// Thread safe lazy initialization through function local static
+		const static TArray<FIcoMeshTemplate> Templates = []()
+		{
+			TArray<FIcoMeshTemplate> OutTemplates;
+			for (int32 i = 0; i <= MaxCachedIcoMeshSubdivisions(); ++i)
+				OutTemplates.Add(BuildIcoMeshTemplate(UnitIcoSphereVertices, UnitIcoSphereIndices, i));
+			return OutTemplates;
+		}();
 
-		for (FVector& Vertex : IcoSphere.VertexList)
-			Vertex = SphereCenter + (SphereRadius * Vertex);
+		if (Templates.IsValidIndex(Subdivisions))
+			return Templates[Subdivisions];
 
-		return IcoSphere;
+		return UncachedTemplate.Emplace(BuildIcoMeshTemplate(UnitIcoSphereVertices, UnitIcoSphereIndices, Subdivisions));
 	}
 
-	FIndexedTriangleMesh TriangulateSphylElem(float HalfHeight, float Radius, const FVector& CapsuleCenter, const FRotator& CapsuleRotation, int32 Subdivisions)
+	FIcoCapsuleTemplate BuildIcoCapsuleTemplate(const FIcoMeshTemplate& IcoSphere)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateSphylElem);
-
-		const auto SubdivideIcoCapsule = [&](FIndexedTriangleMesh& InIcoSphere)
-		{
-			TMap<FEdgeKey, int32> EdgeLookup;
-			EdgeLookup.Reserve(InIcoSphere.IndexList.Num());
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuildIcoCapsuleTemplate);
 
-			FIndexList NewIndexList;
-			NewIndexList.Reserve(InIcoSphere.IndexList.Num() * 3);
-
-			const auto VertexForEdge = [&](int32 First, int32 Second)->int32
-			{
-				const FEdgeKey Key(First, Second);
-				if (const auto* Index = EdgeLookup.Find(Key))
-					return *Index;
+		const int32 NumTriangles = IcoSphere.IndexList.Num() / 3;
 
-				const auto GetPointClampedToCapsule = [&](const FVector& Point)->FVector
-				{
-					const FVector PointOnLine = FVector(0.f, 0.f, FMath::Clamp(Point.Z, -HalfHeight, HalfHeight));
-					return PointOnLine + (Point - PointOnLine).GetSafeNormal() * Radius;
-				};
+		TBitArray<> TopTriangles(false, NumTriangles);
+		TMap<FIntPoint, int32> DirectedEdgeTriangles;
+		DirectedEdgeTriangles.Reserve(IcoSphere.IndexList.Num());
 
-				return EdgeLookup.Add(Key, InIcoSphere.VertexList.Add(GetPointClampedToCapsule((InIcoSphere.VertexList[First] + InIcoSphere.VertexList[Second]) / 2.f)));
-			};
+		for (int32 TriangleIndex = 0; TriangleIndex < NumTriangles; TriangleIndex++)
+		{
+			const int32* Indices = &IcoSphere.IndexList[TriangleIndex * 3];
+			const FVector Normal = FVector::CrossProduct(
+				IcoSphere.VertexList[Indices[1]] - IcoSphere.VertexList[Indices[0]], IcoSphere.VertexList[Indices[2]] - IcoSphere.VertexList[Indices[0]]);
+			TopTriangles[TriangleIndex] = Normal.Z >= 0.0;
 
-			for (int32 i = 0; i < InIcoSphere.IndexList.Num(); i += 3)
-			{
-				const int32* Indices = &InIcoSphere.IndexList[i];
-				const int32  Mid[3] = {
-					VertexForEdge(Indices[0], Indices[1]),
-					VertexForEdge(Indices[1], Indices[2]),
-					VertexForEdge(Indices[2], Indices[0])
-				};
+			for (int32 Corner = 0; Corner < 3; Corner++)
+				DirectedEdgeTriangles.Add(FIntPoint(Indices[Corner], Indices[(Corner + 1) % 3]), TriangleIndex);
+		}
 
-				NewIndexList.Append(
-				{
-					Indices[0], Mid[0], Mid[2],
-					Indices[1], Mid[1], Mid[0],
-					Indices[2], Mid[2], Mid[1],
-					Mid[0], Mid[1], Mid[2]
-				});
-			}
+		FIcoCapsuleTemplate Template;
 
-			InIcoSphere.IndexList = NewIndexList;
-		};
+		// The vertices on the cut are used by both halves and get one copy in each
+		TArray<int32> HalfVertices;
+		HalfVertices.Init(INDEX_NONE, IcoSphere.VertexList.Num() * 2);
 
-		// This is an icosphere with two extra ege-lopps added close to the center of the sphere
-		const static FVertexList UnitIcoCapsuleVertices = 
+		const auto GetHalfVertex = [&](int32 SphereVertex, bool bTopHalf)
 		{
-			FVector( 0.000000,  0.000000, -1.000000),
-			FVector(-0.298397, -0.950923,  0.010073),
-			FVector(-0.928606,  0.354351,  0.010073),
-			FVector(-0.096003,  0.990428,  0.010073),
-			FVector( 0.985126,  0.141899,  0.010073),
-			FVector( 0.596667, -0.794547,  0.010073),
-			FVector(-0.523123,  0.721003,  0.447216),
-			FVector( 0.846867, -0.272612,  0.447216),
-			FVector(-0.005630, -0.888794,  0.447216),
-			FVector( 0.000000,  0.000000,  1.000000),
-			FVector(-0.551103, -0.698217, -0.447216),
-			FVector(-0.846022,  0.271767, -0.447216),
-			FVector( 0.844210,  0.282815, -0.447216),
-			FVector(-0.840977, -0.286048,  0.447216),
-			FVector( 0.555094,  0.694226,  0.447216),
-			FVector( 0.005171,  0.889254, -0.447216),
-			FVector( 0.521323, -0.719203, -0.447216),
-			FVector( 0.095119, -0.989544, -0.010073),
-			FVector(-0.983501, -0.143524, -0.010073),
-			FVector(-0.598766,  0.796646, -0.010073),
-			FVector( 0.302931,  0.946389, -0.010073),
-			FVector( 0.929726, -0.355471, -0.010073),
-		};
-
-		const static FIndexList UnitIcoCapsuleIndices =
-		{
-			0,10,11,  10,0,16,  0,11,15,  0,15,12,
-			0,12,16,  1,5,8,    2,1,13,   3,2,6,
-			4,3,14,   5,4,7,    1,8,13,   2,13,6,
-			3,6,14,   4,14,7,   5,7,8,    13,8,9,
-			6,13,9,   14,6,9,   7,14,9,   8,7,9,
-			10,16,17, 11,10,18, 15,11,19, 12,15,20,
-			16,12,21, 10,17,18,	11,18,19, 15,19,20,
-			12,20,21, 16,21,17,	2,18,1,   19,18,2,
-			20,19,3,  21,20,4,	21,5,17,  18,17,1,
-			3,19,2,   4,20,3,	5,21,4,   5,1,17
+			int32& Vertex = HalfVertices[SphereVertex * 2 + (bTopHalf ? 0 : 1)];
+			if (Vertex == INDEX_NONE)
+			{
+				Vertex = Template.VertexList.Add(IcoSphere.VertexList[SphereVertex]);
+				Template.HalfHeightSigns.Add(bTopHalf ? (int8)1 : (int8)-1);
+			}
+			return Vertex;
 		};
 
-		FIndexedTriangleMesh IcoCapsule = { UnitIcoCapsuleVertices, UnitIcoCapsuleIndices };
+		Template.IndexList.Reserve(IcoSphere.IndexList.Num() * 2);
+		for (int32 i = 0; i < IcoSphere.IndexList.Num(); i++)
+			Template.IndexList.Add(GetHalfVertex(IcoSphere.IndexList[i], TopTriangles[i / 3]));
 
-		for (int32 i = 0; i < IcoCapsule.VertexList.Num(); i++)
+		// A quad below every edge where a top triangle meets a bottom one, winding the opposite way of the edge in the top triangle
+		for (const TPair<FIntPoint, int32>& DirectedEdge : DirectedEdgeTriangles)
 		{
-			IcoCapsule.VertexList[i] *= Radius;
+			const int32* OppositeTriangle = DirectedEdgeTriangles.Find(FIntPoint(DirectedEdge.Key.Y, DirectedEdge.Key.X));
+			if (!TopTriangles[DirectedEdge.Value] || !OppositeTriangle || TopTriangles[*OppositeTriangle])
+				continue;
 
-			// Take all the top vertices+middle verices and move them up, then move all the bottom vertices+new vertices down
-			if (!FMath::IsNearlyZero(IcoCapsule.VertexList[i].Z))
-				IcoCapsule.VertexList[i].Z += (IcoCapsule.VertexList[i].Z > 0 ? 1 : -1) * HalfHeight;
+			const int32 TopA    = GetHalfVertex(DirectedEdge.Key.X, true);
+			const int32 TopB    = GetHalfVertex(DirectedEdge.Key.Y, true);
+			const int32 BottomA = GetHalfVertex(DirectedEdge.Key.X, false);
+			const int32 BottomB = GetHalfVertex(DirectedEdge.Key.Y, false);
+			Template.IndexList.Append({ TopB, TopA, BottomA, TopB, BottomA, BottomB });
 		}
 
-		for (int32 i = 0; i < Subdivisions; ++i)
-			SubdivideIcoCapsule(IcoCapsule);
-
-		const FTransform CapsuleTransform = FTransform(CapsuleRotation, CapsuleCenter);
-		for (FVector& Vertex : IcoCapsule.VertexList)
-			Vertex = CapsuleTransform.TransformPosition(Vertex);
-
-		return IcoCapsule;
+		return Template;
 	}
 
-	FIndexedTriangleMesh TriangulateWaterPhysicsCollisionSetup(const FWaterPhysicsCollisionSetup& CollisionSetup, const FTriangleSubdivisionSettings& SubdivisionSettings)
+	const FIcoCapsuleTemplate& GetIcoCapsuleTemplate(int32 Subdivisions, TOptional<FIcoCapsuleTemplate>& UncachedTemplate)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateWaterPhysicsCollisionSetup);
-
-		// Triangulate each collision setup
-		TArray<FIndexedTriangleMesh> TriangleMeshes;
-		TriangleMeshes.Reserve(CollisionSetup.NumCollisionElems());
+		// Thread safe lazy initialization through function local static
+		const static TArray<FIcoCapsuleTemplate> Templates = []()
 		{
-			for (const FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
-				TriangleMeshes.Add(TriangulateSphereElem(SphereElem.Radius, SphereElem.Center, SubdivisionSettings.Sphere));
+			TArray<FIcoCapsuleTemplate> OutTemplates;
+			for (int32 i = 0; i <= MaxCachedIcoMeshSubdivisions(); ++i)
+			{
+				TOptional<FIcoMeshTemplate> UncachedIcoSphere;
+				OutTemplates.Add(BuildIcoCapsuleTemplate(GetIcoSphereTemplate(i, UncachedIcoSphere)));
+			}
+			return OutTemplates;
+		}();
 
-			for (const FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
-				TriangleMeshes.Add(TriangulateBoxElem(BoxElem.Extent, BoxElem.Center, BoxElem.Rotation, SubdivisionSettings.Box));
+		if (Templates.IsValidIndex(Subdivisions))
+			return Templates[Subdivisions];
 
-			for (const FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
-				TriangleMeshes.Add(TriangulateSphylElem(SphylElem.HalfHeight, SphylElem.Radius, SphylElem.Center, SphylElem.Rotation, SubdivisionSettings.Capsule));
+		TOptional<FIcoMeshTemplate> UncachedIcoSphere;
+		return UncachedTemplate.Emplace(BuildIcoCapsuleTemplate(GetIcoSphereTemplate(Subdivisions, UncachedIcoSphere)));
+	}
 
-			for (const FWaterPhysicsCollisionSetup::FMeshElem& MeshElem : CollisionSetup.MeshElems)
-			{
-				FIndexedTriangleMesh TriangulatedMesh;
-				TriangulatedMesh.VertexList = MeshElem.VertexList;
-				TriangulatedMesh.IndexList = MeshElem.IndexList;
+	// Appends Indices to OutMesh, offsetting them by the current vertex count. Vertices has to be appended after calling this.
+	FORCEINLINE void AppendOffsetIndices(FIndexedTriangleMesh& OutMesh, const FIndexList& Indices)
+	{
+		const int32 IndexOffset      = OutMesh.VertexList.Num();
+		const int32 IndexOffsetStart = OutMesh.IndexList.Num();
 
-				FTessellationSettings TessellationSettings;
-				TessellationSettings.TessellationMode = EWaterPhysicsTessellationMode::Levels;
-				TessellationSettings.Levels = SubdivisionSettings.Convex;
-				TessellateTriangles(TriangulatedMesh, TessellationSettings);
+		OutMesh.IndexList.SetNumUninitialized(IndexOffsetStart + Indices.Num());
+		for (int32 i = 0; i < Indices.Num(); ++i)
+			OutMesh.IndexList[IndexOffsetStart + i] = Indices[i] + IndexOffset;
+	}
 
-				TriangleMeshes.Add(TriangulatedMesh);
-			}
-		}
+	void AppendSphereVertices(FVertexList& OutVertexList, const FIcoMeshTemplate& IcoSphere, float SphereRadius, const FVector& SphereCenter)
+	{
+		OutVertexList.Reserve(OutVertexList.Num() + IcoSphere.VertexList.Num());
+		for (const FVector& Vertex : IcoSphere.VertexList)
+			OutVertexList.Add(SphereCenter + (SphereRadius * Vertex));
+	}
 
-		// TODO: Perform boolean operations to remove internal triangles
-		FIndexedTriangleMesh OutTriangulatedMesh;
-		for (const auto& TriangleMesh : TriangleMeshes)
+	void AppendSphylVertices(FVertexList& OutVertexList, const FIcoCapsuleTemplate& IcoCapsule, float HalfHeight, float Radius, const FVector& CapsuleCenter, const FRotator& CapsuleRotation)
+	{
+		const FTransform CapsuleTransform = FTransform(CapsuleRotation, CapsuleCenter);
+		OutVertexList.Reserve(OutVertexList.Num() + IcoCapsule.VertexList.Num());
+		for (int32 i = 0; i < IcoCapsule.VertexList.Num(); i++)
 		{
-			const int32 IndexOffset      = OutTriangulatedMesh.VertexList.Num();
-			const int32 IndexOffsetStart = OutTriangulatedMesh.IndexList.Num();
-
-			OutTriangulatedMesh.VertexList.Append(TriangleMesh.VertexList);
-			OutTriangulatedMesh.IndexList.Append(TriangleMesh.IndexList);
-
-			if (IndexOffset > 0)
-			{
-				for (int32 i = IndexOffsetStart; i < OutTriangulatedMesh.IndexList.Num(); ++i)
-				{
-					OutTriangulatedMesh.IndexList[i] += IndexOffset;
-					check(OutTriangulatedMesh.IndexList[i] >= 0 && OutTriangulatedMesh.IndexList[i] < OutTriangulatedMesh.VertexList.Num());
-				}
-			}
+			const FVector Vertex = IcoCapsule.VertexList[i] * Radius + FVector(0.f, 0.f, IcoCapsule.HalfHeightSigns[i] * HalfHeight);
+			OutVertexList.Add(CapsuleTransform.TransformPosition(Vertex));
 		}
-
-		return OutTriangulatedMesh;
 	}
 
-	FWaterPhysicsCollisionSetup GenerateBodyInstanceWaterPhysicsCollisionSetup(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies)
+	void TriangulateSphereElem(FIndexedTriangleMesh& OutMesh, float SphereRadius, const FVector& SphereCenter, int32 Subdivisions)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(GenerateBodyInstanceWaterPhysicsCollisionSetup);
+		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateSphereElem);
 
-		FWaterPhysicsCollisionSetup OutCollisionSetup;
+		TOptional<FIcoMeshTemplate> UncachedTemplate;
+		const FIcoMeshTemplate& IcoSphere = GetIcoSphereTemplate(Subdivisions, UncachedTemplate);
 
-		// NOTE: AddSphereElem, AddBoxElem, AddSphylElem and AddConvexElem mimics the scaling behaviour of UE4. This scaling is buggy
-		// and has therefore been created to intentionally follow this buggy behaviour.
-		// TODO: This is pretty much copy-pasted in WaterPhysicsMath.cpp, refactor to used shared scaling logic
+		AppendOffsetIndices(OutMesh, IcoSphere.IndexList);
+		AppendSphereVertices(OutMesh.VertexList, IcoSphere, SphereRadius, SphereCenter);
+	}
 
-		const auto AddSphereElem = [&](const FKSphereElem& SphereElem, const FTransform& ParentInstanceWorldTransform, 
-			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
-		{
-			const FVector BodyScale3DAbs = BodyScale3D.GetAbs();
-			const float SphereRadius = FMath::Max(SphereElem.Radius * FMath::Min3(BodyScale3DAbs.X, BodyScale3DAbs.Y, BodyScale3DAbs.Z), FCollisionShape::MinSphereRadius());
-			const FTransform SphereWorldTransform = FTransform(FRotator::ZeroRotator, WeldedRelativeTransform.TransformPosition(SphereElem.Center) * ParentBodyScale3D) 
-				* ParentInstanceWorldTransform;
-			OutCollisionSetup.SphereElems.Add({ SphereWorldTransform.GetLocation(), SphereRadius });
-		};
+	void TriangulateSphylElem(FIndexedTriangleMesh& OutMesh, float HalfHeight, float Radius, const FVector& CapsuleCenter, const FRotator& CapsuleRotation, int32 Subdivisions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateSphylElem);
 
-		const auto AddBoxElem = [&](const FKBoxElem& BoxElem, const FTransform& ParentInstanceWorldTransform, 
-			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
-		{
-			const FVector BodyScale3DAbs = BodyScale3D.GetAbs();
-			const FVector BoxHalfExtents(
-				FMath::Max(0.5f * BoxElem.X * BodyScale3DAbs.X, FCollisionShape::MinBoxExtent()),
-				FMath::Max(0.5f * BoxElem.Y * BodyScale3DAbs.Y, FCollisionShape::MinBoxExtent()),
-				FMath::Max(0.5f * BoxElem.Z * BodyScale3DAbs.Z, FCollisionShape::MinBoxExtent())
-			);
-			const FTransform BoxWorldTransform = FTransform(
-				WeldedRelativeTransform.TransformRotation(BoxElem.Rotation.Quaternion()),
-				WeldedRelativeTransform.TransformPosition(BoxElem.Center) * ParentBodyScale3D) * ParentInstanceWorldTransform;
+		TOptional<FIcoCapsuleTemplate> UncachedTemplate;
+		const FIcoCapsuleTemplate& IcoCapsule = GetIcoCapsuleTemplate(Subdivisions, UncachedTemplate);
 
-			OutCollisionSetup.BoxElems.Add({ BoxWorldTransform.GetLocation(), BoxWorldTransform.Rotator(), BoxHalfExtents });
-		};
+		AppendOffsetIndices(OutMesh, IcoCapsule.IndexList);
+		AppendSphylVertices(OutMesh.VertexList, IcoCapsule, HalfHeight, Radius, CapsuleCenter, CapsuleRotation);
+	}
 
-		const auto AddSphylElem = [&](const FKSphylElem& SphylElem, const FTransform& ParentInstanceWorldTransform, 
-			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+	// A collision consisting of a single sphere or capsule only needs the vertices of its cached template placed, the body mesh then
+	// references the template indices instead of copying them. Returns an empty view for any other collision, OutVertexList is then untouched.
+	TConstArrayView<int32> TriangulateSinglePrimitiveElem(const FWaterPhysicsCollisionSetup& CollisionSetup, const FTriangleSubdivisionSettings& SubdivisionSettings, 
+		FVertexList& OutVertexList)
+	{
+		if (CollisionSetup.NumCollisionElems() != 1)
+			return TConstArrayView<int32>();
+
+		if (CollisionSetup.SphereElems.Num() == 1)
 		{
-			const FVector BodyScale3DAbs   = BodyScale3D.GetAbs();
-			const float   ScaledHalfHeight = (SphylElem.Length + SphylElem.Radius * 2.f) * BodyScale3DAbs.Z * 0.5f;
-			const float   ScaledRadius     = FMath::Max(SphylElem.Radius * FMath::Max(BodyScale3DAbs.X, BodyScale3DAbs.Y), 0.1f);
-			const float   FinalRadius      = FMath::Max(FMath::Min(ScaledRadius, ScaledHalfHeight), FCollisionShape::MinCapsuleRadius());
-			const float   FinalHalfHeight  = FMath::Max(FCollisionShape::MinCapsuleAxisHalfHeight(), ScaledHalfHeight - FinalRadius);
-			const FTransform SphylWorldTransform = FTransform(
-				WeldedRelativeTransform.TransformRotation(SphylElem.Rotation.Quaternion()),
-				WeldedRelativeTransform.TransformPosition(SphylElem.Center) * ParentBodyScale3D) * ParentInstanceWorldTransform;
-			OutCollisionSetup.SphylElems.Add({ SphylWorldTransform.GetLocation(), SphylWorldTransform.Rotator(), FinalRadius, FinalHalfHeight });
-		};
+			TOptional<FIcoMeshTemplate> UncachedTemplate;
+			const FIcoMeshTemplate& IcoSphere = GetIcoSphereTemplate(SubdivisionSettings.Sphere, UncachedTemplate);
+			if (UncachedTemplate.IsSet())
+				return TConstArrayView<int32>();
+
+			const FWaterPhysicsCollisionSetup::FSphereElem& SphereElem = CollisionSetup.SphereElems[0];
+			AppendSphereVertices(OutVertexList, IcoSphere, SphereElem.Radius, SphereElem.Center);
+			return IcoSphere.IndexList;
+		}
 
-		const auto AddConvexElem = [&](const FKConvexElem& ConvexElem, const FTransform& ParentInstanceWorldTransform, 
-			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+		if (CollisionSetup.SphylElems.Num() == 1)
 		{
-			FTransform LocalConvexElemTransform = ConvexElem.GetTransform();
-			const bool bUseNegX = CalcMeshNegScaleCompensation(BodyScale3D, LocalConvexElemTransform);
-			const FTransform ConvexWorldTransform = FTransform(
-				WeldedRelativeTransform.TransformRotation(LocalConvexElemTransform.GetRotation()),
-				WeldedRelativeTransform.TransformPosition(LocalConvexElemTransform.GetLocation())  * ParentBodyScale3D,
-				BodyScale3D.GetAbs()
-			) * ParentInstanceWorldTransform;
+			TOptional<FIcoCapsuleTemplate> UncachedTemplate;
+			const FIcoCapsuleTemplate& IcoCapsule = GetIcoCapsuleTemplate(SubdivisionSettings.Capsule, UncachedTemplate);
+			if (UncachedTemplate.IsSet())
+				return TConstArrayView<int32>();
+
+			const FWaterPhysicsCollisionSetup::FSphylElem& SphylElem = CollisionSetup.SphylElems[0];
+			AppendSphylVertices(OutVertexList, IcoCapsule, SphylElem.HalfHeight, SphylElem.Radius, SphylElem.Center, SphylElem.Rotation);
+			return IcoCapsule.IndexList;
+		}
 
-			FWaterPhysicsCollisionSetup::FMeshElem MeshElem = ExtractConvexElemTriangles(ConvexElem, bUseNegX);
+		return TConstArrayView<int32>();
+	}
 
-			for (FVector& Vertex : MeshElem.VertexList)
-				Vertex = ConvexWorldTransform.TransformPosition(Vertex);
+	// The triangulation of a convex collision element, used to remove the parts of other collision elements which are buried inside of it.
+	// Spheres and capsules occlude with their triangulation rather than their true surface, so the clipped elements meet them exactly.
+	struct FConvexOccluder
+	{
+		int32 ElemIndex;
+		FBox  Bounds;
 
-			OutCollisionSetup.MeshElems.Add(MeshElem);
-		};
+		// Facing outwards
+		TArray<FPlane, TInlineAllocator<32>> Planes;
 
-		FBodyInstance* OriginalBodyInstance = BodyInstance;
-		BodyInstance = BodyInstance->WeldParent ? BodyInstance->WeldParent : BodyInstance;
+		// In cm. Much larger and the snapping leaves slivers between the planes of finely subdivided spheres and capsules which don't line up.
+		static constexpr float Tolerance() { return 0.001f; }
 
-		TArray<FPhysicsShapeHandle> Shapes;
-		FTransform BodyInstanceTransform(NoInit);
-		FPhysicsCommand::ExecuteRead(BodyInstance->GetPhysicsActorHandle(), [&](const FPhysicsActorHandle& ActorHandle)
+		// Negative inside of the occluder
+		FORCEINLINE FVector::FReal SignedDistance(const FVector& Point) const
 		{
-			BodyInstance->GetAllShapes_AssumesLocked(Shapes);
-			BodyInstanceTransform = BodyInstance->GetUnrealWorldTransform_AssumesLocked();
-		});
+			FVector::FReal MaxDistance = -BIG_NUMBER;
+			for (const FPlane& Plane : Planes)
+				MaxDistance = FMath::Max(MaxDistance, Plane.PlaneDot(Point));
+			return MaxDistance;
+		}
 
-		for (const FPhysicsShapeHandle& Shape : Shapes)
+		FORCEINLINE bool IsInside(const FVector& Point) const { return SignedDistance(Point) < -Tolerance(); }
+
+		// Builds an occluder from the triangles [TriangleStart, TriangleEnd) of Mesh. Returns false if they are not convex, or too many to be worth using as an occluder.
+		static bool MakeConvexMesh(int32 ElemIndex, const FIndexedTriangleMesh& Mesh, int32 TriangleStart, int32 TriangleEnd, FConvexOccluder& OutOccluder)
 		{
-			const FBodyInstance* ShapeBodyInstance = BodyInstance->GetOriginalBodyInstance(Shape);
+			if (TriangleEnd - TriangleStart > MaxConvexMeshTriangles() || TriangleEnd - TriangleStart < 4)
+				return false;
 
-			if (!bIncludeWeldedBodies && ShapeBodyInstance != OriginalBodyInstance)
-				continue;
+			// The vertices of an element are appended in one go, so they form a contiguous range
+			int32 FirstVertex = MAX_int32;
+			int32 LastVertex  = 0;
+			for (int32 i = TriangleStart * 3; i < TriangleEnd * 3; i++)
+			{
+				FirstVertex = FMath::Min(FirstVertex, Mesh.IndexList[i]);
+				LastVertex  = FMath::Max(LastVertex, Mesh.IndexList[i]);
+			}
 
-			const ECollisionShapeType GeomType  = FPhysicsInterface::GetShapeType(Shape);
-			FKShapeElem* const        ShapeElem = FUserData::Get<FKShapeElem>(FPhysicsInterface::GetUserData(Shape));
+			FVector Centroid = FVector::ZeroVector;
+			for (int32 i = FirstVertex; i <= LastVertex; i++)
+				Centroid += Mesh.VertexList[i];
+			Centroid /= LastVertex - FirstVertex + 1;
 
-			if (ShapeElem && !ShapeElem->GetContributeToMass()) // Ignore bodies which are not contributing to mass
-				continue;
+			OutOccluder.ElemIndex = ElemIndex;
+			OutOccluder.Bounds    = FBox(&Mesh.VertexList[FirstVertex], LastVertex - FirstVertex + 1);
+			OutOccluder.Planes.Reset();
 
-			// GetRelativeBodyTransform checks that we are in game thread for no reason, we therefore inline its contents without that check
-			const static auto ThreadedGetRelativeBodyTransform = [](const FBodyInstance* InBodyInstance, const FPhysicsShapeHandle& InShape)->FTransform
+			for (int32 i = TriangleStart * 3; i < TriangleEnd * 3; i += 3)
 			{
-				const FBodyInstance* BI = InBodyInstance->WeldParent ? InBodyInstance->WeldParent : InBodyInstance;
-				const TMap<FPhysicsShapeHandle, FBodyInstance::FWeldInfo>* ShapeToBodiesMap = BI->GetCurrentWeldInfo();
-				const FBodyInstance::FWeldInfo* Result = ShapeToBodiesMap ? ShapeToBodiesMap->Find(InShape) : nullptr;
-				return Result ? Result->RelativeTM : FTransform::Identity;
-			};
+				const FVector& A = Mesh.VertexList[Mesh.IndexList[i + 0]];
+				const FVector& B = Mesh.VertexList[Mesh.IndexList[i + 1]];
+				const FVector& C = Mesh.VertexList[Mesh.IndexList[i + 2]];
+
+				FVector Normal = FVector::CrossProduct(B - A, C - A);
+				if (!Normal.Normalize())
+					continue; // Degenerate triangle
+
+				// Orient the plane away from the centroid, as the winding differs depending on where the mesh came from
+				FPlane Plane(A, Normal);
+				if (Plane.PlaneDot(Centroid) > 0)
+					Plane = Plane.Flip();
+
+				// Tessellated faces give many triangles on the same plane
+				const bool bDuplicate = OutOccluder.Planes.ContainsByPredicate([&](const FPlane& Other) 
+				{ 
+					return (Other.GetNormal() | Plane.GetNormal()) > 1.f - UE_KINDA_SMALL_NUMBER && FMath::Abs(Other.W - Plane.W) < Tolerance(); 
+				});
+				if (bDuplicate)
+					continue;
 
-			const FVector    ParentBodyScale3D = BodyInstance->Scale3D;
-			const FVector    ShapeBodyScale3D  = ShapeBodyInstance->Scale3D;
-			const FTransform RelativeBodyTM    = ThreadedGetRelativeBodyTransform(BodyInstance, Shape); // The relative transform between the body and its welded parent (identity if not welded)
+				for (int32 j = FirstVertex; j <= LastVertex; j++)
+				{
+					if (Plane.PlaneDot(Mesh.VertexList[j]) > Tolerance())
+						return false;
+				}
 
-			switch (GeomType)
-			{
-			case ECollisionShapeType::Sphere:
-				AddSphereElem(*ShapeElem->GetShapeCheck<FKSphereElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
-				break;
-			case ECollisionShapeType::Box:
-				AddBoxElem(*ShapeElem->GetShapeCheck<FKBoxElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
-				break;
-			case ECollisionShapeType::Capsule:
-				AddSphylElem(*ShapeElem->GetShapeCheck<FKSphylElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
-				break;
-			case ECollisionShapeType::Convex:
-				AddConvexElem(*ShapeElem->GetShapeCheck<FKConvexElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
-				break;
-			case ECollisionShapeType::Trimesh:
-				break; // Trimesh cannot simulate physics, cannot support
-			case ECollisionShapeType::Heightfield:
-				break; // Not supported by water physics
-			default:
-				UE_LOG(LogWaterPhysics, Error, TEXT("Triangulate body instance - Unknown geom type."));
+				OutOccluder.Planes.Add(Plane);
 			}
+
+			return OutOccluder.Planes.Num() >= 4;
 		}
 
-		return OutCollisionSetup;
-	}
+		static constexpr int32 MaxConvexMeshTriangles() { return 2048; }
+	};
 
-	FWaterPhysicsCollisionSetup GenerateWaterPhysicsCollisionSetup(const IWaterPhysicsCollisionInterface* CollisionInterface, const FName& BodyName)
+	typedef TArray<FVector, TInlineAllocator<12>> FClipPolygon;
+
+	// Splits Polygon along Plane into the part in front of (outside) and behind (inside) the plane. 
+	// Both are left empty if the polygon lies in the plane.
+	void SplitPolygon(const FClipPolygon& Polygon, const FPlane& Plane, FClipPolygon& OutFront, FClipPolygon& OutBack)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(GenerateWaterPhysicsCollisionSetup);
+		OutFront.Reset();
+		OutBack.Reset();
 
-		FWaterPhysicsCollisionSetup CollisionSetup = CollisionInterface->GenerateWaterPhysicsCollisionSetup(BodyName);
-		const FTransform CollisionTransform = CollisionInterface->GetWaterPhysicsCollisionWorldTransform(BodyName);
+		TArray<FVector::FReal, TInlineAllocator<12>> Distances;
+		Distances.SetNumUninitialized(Polygon.Num());
 
-		// Transform the Collision Setup to correct world transform
-		for (FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
-			TransformSphereElem(SphereElem, CollisionTransform);
+		bool bAnyFront = false;
+		bool bAnyBack  = false;
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const FVector::FReal Distance = Plane.PlaneDot(Polygon[i]);
+			Distances[i] = FMath::Abs(Distance) < FConvexOccluder::Tolerance() ? 0.0 : Distance; // Snap to the plane to avoid slivers
+			bAnyFront |= Distances[i] > 0.0;
+			bAnyBack  |= Distances[i] < 0.0;
+		}
 
-		for (FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
-			TransformBoxElem(BoxElem, CollisionTransform);
+		if (!bAnyBack)  { if (bAnyFront) OutFront = Polygon; return; }
+		if (!bAnyFront) { OutBack = Polygon; return; }
 
-		for (FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
-			TransformSphylElem(SphylElem, CollisionTransform);
+		for (int32 i = 0; i < Polygon.Num(); i++)
+		{
+			const int32         Next = (i + 1) % Polygon.Num();
+			const FVector::FReal D0  = Distances[i];
+			const FVector::FReal D1  = Distances[Next];
 
-		for (FWaterPhysicsCollisionSetup::FMeshElem& MeshElem : CollisionSetup.MeshElems)
-			TransformMeshElem(MeshElem, CollisionTransform);
+			if (D0 >= 0.0) OutFront.Add(Polygon[i]);
+			if (D0 <= 0.0) OutBack.Add(Polygon[i]);
 
-		return CollisionSetup;
+			if ((D0 > 0.0 && D1 < 0.0) || (D0 < 0.0 && D1 > 0.0))
+			{
+				const FVector Intersection = FMath::Lerp(Polygon[i], Polygon[Next], D0 / (D0 - D1));
+				OutFront.Add(Intersection);
+				OutBack.Add(Intersection);
+			}
+		}
 	}
 
-	FSubmergedTriangleArray PerformTriangleMeshWaterIntersection(const FWaterSurfaceProvider::FVertexWaterInfoArray& VertexWaterInfo, const FIndexedTriangleMesh& TriangleMesh)
+	// Merges vertices closer than Tolerance to each other, and removes the triangles which collapse because of it
+	void WeldVertices(FIndexedTriangleMesh& Mesh, FVector::FReal Tolerance)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PerformTriangleMeshWaterIntersection);
+		TRACE_CPUPROFILER_EVENT_SCOPE(WeldVertices);
 
-		FSubmergedTriangleArray Result;
+		// Vertices within Tolerance of each other are always in neighbouring cells
+		TMap<FIntVector, TArray<int32, TInlineAllocator<2>>> Cells;
+		Cells.Reserve(Mesh.VertexList.Num());
 
-		TArray<float> VertexDepths;
-		VertexDepths.SetNum(TriangleMesh.VertexList.Num());
+		const auto GetCell = [&](const FVector& Position)
+		{
+			return FIntVector(FMath::FloorToInt32(Position.X / Tolerance), FMath::FloorToInt32(Position.Y / Tolerance), FMath::FloorToInt32(Position.Z / Tolerance));
+		};
 
-		TArray<int32> VertexSubmergedIndex;
-		VertexSubmergedIndex.SetNum(TriangleMesh.VertexList.Num());
+		TArray<int32> VertexRemap;
+		VertexRemap.SetNumUninitialized(Mesh.VertexList.Num());
 
-		// Calculate the depth of each vertex
-		for (int32 i = 0; i < TriangleMesh.VertexList.Num(); ++i)
+		FVertexList OutVertexList;
+		OutVertexList.Reserve(Mesh.VertexList.Num());
+
+		for (int32 VertexIndex = 0; VertexIndex < Mesh.VertexList.Num(); VertexIndex++)
 		{
-			VertexDepths[i] = FPlane(VertexWaterInfo[i].WaterSurfaceLocation, VertexWaterInfo[i].WaterSurfaceNormal).PlaneDot(TriangleMesh.VertexList[i]);
+			const FVector&   Position = Mesh.VertexList[VertexIndex];
+			const FIntVector Cell     = GetCell(Position);
 
-			if (VertexDepths[i] < 0.f) {
-				VertexSubmergedIndex[i] = Result.VertexList.Emplace(FSubmergedTriangleArray::FVertex{ TriangleMesh.VertexList[i], VertexWaterInfo[i].WaterVelocity, -VertexDepths[i] });
+			int32 WeldedIndex = INDEX_NONE;
+			for (int32 Z = -1; Z <= 1 && WeldedIndex == INDEX_NONE; Z++)
+			for (int32 Y = -1; Y <= 1 && WeldedIndex == INDEX_NONE; Y++)
+			for (int32 X = -1; X <= 1 && WeldedIndex == INDEX_NONE; X++)
+			{
+				if (const auto* CellVertices = Cells.Find(Cell + FIntVector(X, Y, Z)))
+				{
+					if (const int32* Found = CellVertices->FindByPredicate([&](int32 Other) { return FVector::DistSquared(OutVertexList[Other], Position) <= Tolerance * Tolerance; }))
+						WeldedIndex = *Found;
+				}
+			}
+
+			if (WeldedIndex == INDEX_NONE)
+			{
+				WeldedIndex = OutVertexList.Add(Position);
+				Cells.FindOrAdd(Cell).Add(WeldedIndex);
 			}
-		}
 
-		TMap<FEdgeKey, int32> EdgeSplitVertices;
-		EdgeSplitVertices.Reserve(TriangleMesh.VertexList.Num() * 2); // Some extra slack for reduced hash collision
+			VertexRemap[VertexIndex] = WeldedIndex;
+		}
 
-		struct FVertexIndex
+		FIndexList OutIndexList;
+		OutIndexList.Reserve(Mesh.IndexList.Num());
+		for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
 		{
-			int32 Index;
-			int32 VertexOrderIndex; // Order on triangle (0/1/2)
-		};
-		TArray<FVertexIndex, TInlineAllocator<3>> VerticesOverSurface;
-		TArray<FVertexIndex, TInlineAllocator<3>> VerticesUnderSurface;
-		for (int32 i = 0; i < TriangleMesh.IndexList.Num(); i+=3)
+			const int32 A = VertexRemap[Mesh.IndexList[i + 0]];
+			const int32 B = VertexRemap[Mesh.IndexList[i + 1]];
+			const int32 C = VertexRemap[Mesh.IndexList[i + 2]];
+			if (A != B && B != C && C != A)
+				OutIndexList.Append({ A, B, C });
+		}
+
+		Mesh.VertexList = MoveTemp(OutVertexList);
+		Mesh.IndexList  = MoveTemp(OutIndexList);
+	}
+
+	static constexpr int32 MaxTJunctionPasses()   { return 64; }
+	static constexpr int32 MaxTJunctionVertices() { return 2048; }
+	static constexpr int32 MaxMeshRepairPasses()  { return 4; }
+
+	TArray<int32> CountEdgeUses(const FTriangleMeshEdges& Edges)
+	{
+		TArray<int32> EdgeUseCount;
+		EdgeUseCount.SetNumZeroed(Edges.NumEdges);
+		for (const int32 EdgeIndex : Edges.EdgeIndexList)
+			EdgeUseCount[EdgeIndex]++;
+		return EdgeUseCount;
+	}
+
+	void RemoveMarkedTriangles(FIndexedTriangleMesh& Mesh, const TBitArray<>& RemovedTriangles)
+	{
+		int32 NumKept = 0;
+		for (int32 TriangleIndex = 0; TriangleIndex < RemovedTriangles.Num(); TriangleIndex++)
 		{
-			VerticesOverSurface.Empty(3);
-			VerticesUnderSurface.Empty(3);
+			if (RemovedTriangles[TriangleIndex])
+				continue;
 
-			for (int32 j = 0; j < 3; j++)
+			for (int32 Corner = 0; Corner < 3; Corner++)
+				Mesh.IndexList[NumKept * 3 + Corner] = Mesh.IndexList[TriangleIndex * 3 + Corner];
+			NumKept++;
+		}
+		Mesh.IndexList.SetNum(NumKept * 3, EAllowShrinking::No);
+	}
+
+	// Clipping two elements against each other gives vertices in the middle of the edges of the other element, where the intersection
+	// curve crosses its edges. Splits the triangles of edges which are only used once at the vertices lying on them.
+	// Each pass tests every open edge against every vertex of an open edge, the number of those vertices is capped by MaxTJunctionVertices
+	// and the mesh is left with its T-junctions beyond it, which makes RemoveInternalTriangles fall back to the overlapping elements.
+	void SplitTJunctions(FIndexedTriangleMesh& Mesh, FVector::FReal Tolerance)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SplitTJunctions);
+
+		// Each pass splits every triangle at most once, an edge with several vertices on it takes several passes
+		for (int32 Pass = 0; Pass < MaxTJunctionPasses(); Pass++)
+		{
+			const FTriangleMeshEdges Edges        = BuildTriangleMeshEdges(Mesh);
+			const TArray<int32>      EdgeUseCount = CountEdgeUses(Edges);
+
+			// Both ends of the open edges, a vertex splitting an edge is always at the end of an open edge on the other side
+			TSet<int32> OpenEdgeVertexSet;
+			for (int32 i = 0; i < Mesh.IndexList.Num(); i++)
 			{
-				const int32 VertexIndex = TriangleMesh.IndexList[i + j];
-				(VertexDepths[VertexIndex] < 0.f ? VerticesUnderSurface : VerticesOverSurface).Add({ VertexIndex, j });
+				if (EdgeUseCount[Edges.EdgeIndexList[i]] == 1)
+				{
+					OpenEdgeVertexSet.Add(Mesh.IndexList[i]);
+					OpenEdgeVertexSet.Add(Mesh.IndexList[i - i % 3 + (i + 1) % 3]);
+				}
 			}
+			const TArray<int32> OpenEdgeVertices = OpenEdgeVertexSet.Array();
 
-			if (VerticesUnderSurface.Num() == 3)
-			{   // Entire triangle is submerged
-				Result.EmplaceTriangle(FSubmergedTriangleArray::FTriangle{
-					{ VertexSubmergedIndex[TriangleMesh.IndexList[i + 0]],
-						VertexSubmergedIndex[TriangleMesh.IndexList[i + 1]],
-						VertexSubmergedIndex[TriangleMesh.IndexList[i + 2]] },
-					i / 3
-				});
-			}
-			else if (VerticesOverSurface.Num() != 3) // Split partially submerged triangle
-			{
-				const FVertexIndex& A = VerticesOverSurface.Num() == 2 ? VerticesUnderSurface[0] : VerticesOverSurface[0];
-				const FVertexIndex& B = VerticesOverSurface.Num() == 2 ? VerticesOverSurface[0] : VerticesUnderSurface[0];
-				const FVertexIndex& C = VerticesOverSurface.Num() == 2 ? VerticesOverSurface[1] : VerticesUnderSurface[1];
+			if (OpenEdgeVertices.Num() == 0 || OpenEdgeVertices.Num() > MaxTJunctionVertices())
+				return;
 
-				const float AAbsVertextDepth = FMath::Abs(VertexDepths[A.Index]);
-				const float BAbsVertextDepth = FMath::Abs(VertexDepths[B.Index]);
-				const float CAbsVertextDepth = FMath::Abs(VertexDepths[C.Index]);
+			bool bAnySplit = false;
 
-				const float ABSplitAlpha = AAbsVertextDepth / (AAbsVertextDepth + BAbsVertextDepth);
-				const float ACSplitAlpha = AAbsVertextDepth / (AAbsVertextDepth + CAbsVertextDepth);
+			FIndexList OutIndexList;
+			OutIndexList.Reserve(Mesh.IndexList.Num() + 3 * OpenEdgeVertices.Num());
+			for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
+			{
+				int32 SplitEdge   = INDEX_NONE;
+				int32 SplitVertex = INDEX_NONE;
+				for (int32 Edge = 0; Edge < 3 && SplitEdge == INDEX_NONE; Edge++)
+				{
+					if (EdgeUseCount[Edges.EdgeIndexList[i + Edge]] != 1)
+						continue;
 
-				const FEdgeKey ABEdgeIndex(A.Index, B.Index);
-				const FEdgeKey ACEdgeIndex(A.Index, C.Index);
+					const int32 A = Mesh.IndexList[i + Edge];
+					const int32 B = Mesh.IndexList[i + (Edge + 1) % 3];
 
-				const int32* ExistingABIndex = EdgeSplitVertices.Find(ABEdgeIndex);
-				const int32* ExistingACIndex = EdgeSplitVertices.Find(ACEdgeIndex);
+					const FVector        EdgeStart = Mesh.VertexList[A];
+					const FVector        EdgeDir   = Mesh.VertexList[B] - EdgeStart;
+					const FVector::FReal EdgeSize  = EdgeDir.Size();
 
-				int32 ABIndex;
-				if (ExistingABIndex != nullptr)
-				{
-					ABIndex = *ExistingABIndex;
+					// The vertex closest to A, the rest of the edge is handled by the next pass
+					FVector::FReal ClosestDistance = EdgeSize - Tolerance;
+					for (const int32 Vertex : OpenEdgeVertices)
+					{
+						// The third vertex of a sliver can lie on its own edge
+						if (Vertex == Mesh.IndexList[i] || Vertex == Mesh.IndexList[i + 1] || Vertex == Mesh.IndexList[i + 2])
+							continue;
+
+						const FVector        ToVertex      = Mesh.VertexList[Vertex] - EdgeStart;
+						const FVector::FReal AlongDistance = (ToVertex | EdgeDir) / EdgeSize;
+						if (AlongDistance > Tolerance && AlongDistance < ClosestDistance
+							&& (ToVertex - EdgeDir * (AlongDistance / EdgeSize)).SizeSquared() <= Tolerance * Tolerance)
+						{
+							ClosestDistance = AlongDistance;
+							SplitEdge       = Edge;
+							SplitVertex     = Vertex;
+						}
+					}
 				}
-				else
+
+				if (SplitEdge == INDEX_NONE)
 				{
-					ABIndex = Result.VertexList.Emplace(FSubmergedTriangleArray::FVertex{
-						FMath::Lerp(TriangleMesh.VertexList[A.Index], TriangleMesh.VertexList[B.Index], ABSplitAlpha),
-						FMath::Lerp(VertexWaterInfo[A.Index].WaterVelocity, VertexWaterInfo[B.Index].WaterVelocity, ABSplitAlpha),
-						0.f
-					});
-					EdgeSplitVertices.Add(ABEdgeIndex, ABIndex);
+					OutIndexList.Append(&Mesh.IndexList[i], 3);
+					continue;
 				}
 
-				int32 ACIndex;
-				if (ExistingACIndex != nullptr)
+				// Keeps the winding of the triangle
+				const int32 A = Mesh.IndexList[i + SplitEdge];
+				const int32 B = Mesh.IndexList[i + (SplitEdge + 1) % 3];
+				const int32 C = Mesh.IndexList[i + (SplitEdge + 2) % 3];
+				OutIndexList.Append({ A, SplitVertex, C, SplitVertex, B, C });
+				bAnySplit = true;
+			}
+
+			Mesh.IndexList = MoveTemp(OutIndexList);
+
+			if (!bAnySplit)
+				return;
+		}
+	}
+
+	// Removes pairs of triangles lying on each other facing opposite ways, the two sides of a sliver which was clipped down to nothing
+	void RemoveFinTriangles(FIndexedTriangleMesh& Mesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RemoveFinTriangles);
+
+		// Rotated to start at the smallest index, the same key for every rotation of the triangle
+		const auto MakeTriangleKey = [](int32 A, int32 B, int32 C)
+		{
+			return A < B && A < C ? FIntVector(A, B, C) : (B < C ? FIntVector(B, C, A) : FIntVector(C, A, B));
+		};
+
+		TMap<FIntVector, TArray<int32, TInlineAllocator<1>>> UnpairedTriangles;
+		UnpairedTriangles.Reserve(Mesh.IndexList.Num() / 3);
+
+		TBitArray<> RemovedTriangles(false, Mesh.IndexList.Num() / 3);
+		bool bAnyRemoved = false;
+
+		for (int32 TriangleIndex = 0; TriangleIndex < Mesh.IndexList.Num() / 3; TriangleIndex++)
+		{
+			const int32* Indices = &Mesh.IndexList[TriangleIndex * 3];
+
+			auto* Opposite = UnpairedTriangles.Find(MakeTriangleKey(Indices[0], Indices[2], Indices[1]));
+			if (Opposite && Opposite->Num() > 0)
+			{
+				RemovedTriangles[Opposite->Pop()] = true;
+				RemovedTriangles[TriangleIndex]   = true;
+				bAnyRemoved = true;
+			}
+			else
+			{
+				UnpairedTriangles.FindOrAdd(MakeTriangleKey(Indices[0], Indices[1], Indices[2])).Add(TriangleIndex);
+			}
+		}
+
+		if (bAnyRemoved)
+			RemoveMarkedTriangles(Mesh, RemovedTriangles);
+	}
+
+	// Removes the triangles with an open edge whose other edges are used by more than two triangles, slivers left on top of the surface 
+	// along an intersection curve. Each removal can leave another one dangling, every pass removes at least one triangle.
+	void RemoveDanglingTriangles(FIndexedTriangleMesh& Mesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RemoveDanglingTriangles);
+
+		for (;;)
+		{
+			const FTriangleMeshEdges Edges        = BuildTriangleMeshEdges(Mesh);
+			const TArray<int32>      EdgeUseCount = CountEdgeUses(Edges);
+
+			TBitArray<> RemovedTriangles(false, Mesh.IndexList.Num() / 3);
+			bool bAnyRemoved = false;
+
+			for (int32 i = 0; i < Mesh.IndexList.Num(); i += 3)
+			{
+				const int32 UseCounts[3] = { EdgeUseCount[Edges.EdgeIndexList[i]], EdgeUseCount[Edges.EdgeIndexList[i + 1]], EdgeUseCount[Edges.EdgeIndexList[i + 2]] };
+				const bool  bAnyOpen     = UseCounts[0] == 1 || UseCounts[1] == 1 || UseCounts[2] == 1;
+				const bool  bAnyShared   = UseCounts[0] == 2 || UseCounts[1] == 2 || UseCounts[2] == 2;
+				if (bAnyOpen && !bAnyShared)
 				{
-					ACIndex = *ExistingACIndex;
+					RemovedTriangles[i / 3] = true;
+					bAnyRemoved = true;
 				}
-				else
+			}
+
+			if (!bAnyRemoved)
+				return;
+
+			RemoveMarkedTriangles(Mesh, RemovedTriangles);
+		}
+	}
+
+	// Every edge is used exactly once in each direction
+	bool IsClosedTriangleMesh(const FIndexedTriangleMesh& Mesh)
+	{
+		if (Mesh.IndexList.Num() == 0)
+			return false;
+
+		TSet<FIntPoint> DirectedEdges;
+		DirectedEdges.Reserve(Mesh.IndexList.Num());
+		for (int32 i = 0; i < Mesh.IndexList.Num(); i++)
+		{
+			bool bAlreadyInSet = false;
+			DirectedEdges.Add(FIntPoint(Mesh.IndexList[i], Mesh.IndexList[i - i % 3 + (i + 1) % 3]), &bAlreadyInSet);
+			if (bAlreadyInSet)
+				return false;
+		}
+
+		return Algo::AllOf(DirectedEdges, [&](const FIntPoint& Edge) { return DirectedEdges.Contains(FIntPoint(Edge.Y, Edge.X)); });
+	}
+
+	/*
+		Removes the triangles (or parts of triangles) of each collision element which are buried inside of another element, leaving the
+		outer shell of the union of the elements. Overlapping elements would otherwise count the overlapping volume several times, 
+		and the buried faces would receive drag.
+
+		Triangles are clipped against the planes of each convex occluder. Where two elements touch, the faces lying on each other are removed,
+		of faces which lie on each other facing the same way only the one of the first element is kept. The pieces are welded to the 
+		rest of the mesh, the T-junctions along the intersection curves are split and the slivers left where the elements barely touch
+		are removed, so the shell stays closed. If the result is not closed anyway, e.g. as an element which is not convex can't occlude 
+		others, the mesh is left untouched.
+
+		Only runs when a body is triangulated. Every triangle is clipped against every occluder whose bounds it touches, building the
+		occluders costs their triangles times their vertices (see FConvexOccluder::MaxConvexMeshTriangles) and the repair is bounded
+		by MaxMeshRepairPasses, MaxTJunctionPasses and MaxTJunctionVertices.
+	*/
+	void RemoveInternalTriangles(FIndexedTriangleMesh& Mesh, const TArray<int32, TInlineAllocator<16>>& ElemTriangleStart, const TArray<FConvexOccluder>& Occluders, 
+		const TCHAR* DebugName)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(RemoveInternalTriangles);
+
+		if (Occluders.Num() == 0 || ElemTriangleStart.Num() < 2)
+			return;
+
+		FIndexList OutIndexList;
+		OutIndexList.Reserve(Mesh.IndexList.Num());
+
+		const int32 NumSourceVertices = Mesh.VertexList.Num();
+
+		FClipPolygon Front, Back;
+		TArray<FClipPolygon, TInlineAllocator<8>> Pieces, NextPieces;
+		bool bAnyClipped = false;
+
+		for (int32 ElemIndex = 0; ElemIndex < ElemTriangleStart.Num(); ElemIndex++)
+		{
+			const int32 TriangleStart = ElemTriangleStart[ElemIndex];
+			const int32 TriangleEnd   = ElemIndex + 1 < ElemTriangleStart.Num() ? ElemTriangleStart[ElemIndex + 1] : Mesh.IndexList.Num() / 3;
+
+			for (int32 TriangleIndex = TriangleStart; TriangleIndex < TriangleEnd; TriangleIndex++)
+			{
+				const int32* Indices = &Mesh.IndexList[TriangleIndex * 3];
+
+				const FVector TriangleNormal = FVector::CrossProduct(
+					Mesh.VertexList[Indices[1]] - Mesh.VertexList[Indices[0]], Mesh.VertexList[Indices[2]] - Mesh.VertexList[Indices[0]]);
+
+				Pieces.Reset();
+				Pieces.Add({ Mesh.VertexList[Indices[0]], Mesh.VertexList[Indices[1]], Mesh.VertexList[Indices[2]] });
+
+				bool bClipped = false;
+
+				for (const FConvexOccluder& Occluder : Occluders)
 				{
-					ACIndex = Result.VertexList.Emplace(FSubmergedTriangleArray::FVertex{
-						FMath::Lerp(TriangleMesh.VertexList[A.Index], TriangleMesh.VertexList[C.Index], ACSplitAlpha),
-						FMath::Lerp(VertexWaterInfo[A.Index].WaterVelocity, VertexWaterInfo[C.Index].WaterVelocity, ACSplitAlpha),
-						0.f
-					});
-					EdgeSplitVertices.Add(ACEdgeIndex, ACIndex);
+					if (Occluder.ElemIndex == ElemIndex)
+						continue;
+
+					NextPieces.Reset();
+					for (FClipPolygon& Piece : Pieces)
+					{
+						// Extended by the tolerance so that faces lying on the occluder are included
+						if (!Occluder.Bounds.ExpandBy(FConvexOccluder::Tolerance()).Intersect(FBox(Piece.GetData(), Piece.Num())))
+						{
+							NextPieces.Add(MoveTemp(Piece));
+							continue;
+						}
+
+						if (Algo::AllOf(Piece, [&](const FVector& V) { return Occluder.IsInside(V); }))
+						{
+							bClipped = true;
+							continue;
+						}
+
+						// Keep the parts outside of each plane
+						FClipPolygon Remaining = MoveTemp(Piece);
+						bool bRemainingOutside = false;
+						for (const FPlane& Plane : Occluder.Planes)
+						{
+							SplitPolygon(Remaining, Plane, Front, Back);
+
+							if (Front.Num() == 0 && Back.Num() == 0)
+							{
+								// Lies on the face of the occluder. Keep it if the faces point the same way and this element comes first.
+								bRemainingOutside = (TriangleNormal | Plane.GetNormal()) > 0.0 && ElemIndex < Occluder.ElemIndex;
+								if (bRemainingOutside)
+									break;
+								continue;
+							}
+
+							bRemainingOutside = Back.Num() < 3;
+							if (bRemainingOutside)
+								break;
+
+							if (Front.Num() >= 3)
+							{
+								NextPieces.Add(Front);
+								bClipped = true;
+							}
+
+							Remaining = Back;
+						}
+
+						// Whatever is not outside of any plane is inside of the occluder
+						if (bRemainingOutside)
+							NextPieces.Add(MoveTemp(Remaining));
+						else
+							bClipped = true;
+					}
+					Swap(Pieces, NextPieces);
+
+					if (Pieces.Num() == 0)
+						break;
 				}
 
-				if (VerticesOverSurface.Num() == 2)
+				if (!bClipped)
 				{
-					const int32 Indices[3] = { VertexSubmergedIndex[A.Index], ABIndex, ACIndex };
-					Result.EmplaceTriangle(FSubmergedTriangleArray::FTriangle{
-						{ Indices[A.VertexOrderIndex], Indices[B.VertexOrderIndex], Indices[C.VertexOrderIndex] }, 
-						i / 3
-					});
+					OutIndexList.Append(Indices, 3);
+					continue;
 				}
-				else
-				{
-					const int32 Indices1[3] = { ABIndex, VertexSubmergedIndex[B.Index], VertexSubmergedIndex[C.Index] }; 
-					Result.EmplaceTriangle(FSubmergedTriangleArray::FTriangle{
-						{ Indices1[A.VertexOrderIndex], Indices1[B.VertexOrderIndex], Indices1[C.VertexOrderIndex] }, 
-						i / 3
-					});
 
-					const int32 Indices2[3] = { ABIndex, ACIndex, VertexSubmergedIndex[C.Index] };
-					Result.EmplaceTriangle(FSubmergedTriangleArray::FTriangle{
-						{ Indices2[B.VertexOrderIndex], Indices2[A.VertexOrderIndex], Indices2[C.VertexOrderIndex] }, 
-						i / 3
-					});
+				bAnyClipped = true;
+
+				// Triangulate the remaining pieces as fans, clipping preserves the winding of the original triangle. 
+				// The vertices are merged with the rest of the mesh by WeldVertices.
+				for (const FClipPolygon& Piece : Pieces)
+				{
+					const int32 FirstVertex = Mesh.VertexList.Num();
+					Mesh.VertexList.Append(Piece.GetData(), Piece.Num());
+					for (int32 i = 1; i < Piece.Num() - 1; i++)
+						OutIndexList.Append({ FirstVertex, FirstVertex + i, FirstVertex + i + 1 });
 				}
 			}
 		}
 
-		return Result;
+		if (!bAnyClipped)
+		{
+			Mesh.VertexList.SetNum(NumSourceVertices);
+			return;
+		}
+
+		FIndexedTriangleMesh ClippedMesh;
+		ClippedMesh.VertexList = Mesh.VertexList;
+		ClippedMesh.IndexList  = MoveTemp(OutIndexList);
+
+		WeldVertices(ClippedMesh, FConvexOccluder::Tolerance());
+
+		// Removing slivers can leave T-junctions behind, which the next pass splits
+		for (int32 Pass = 0; Pass < MaxMeshRepairPasses() && !IsClosedTriangleMesh(ClippedMesh); Pass++)
+		{
+			SplitTJunctions(ClippedMesh, FConvexOccluder::Tolerance());
+			RemoveFinTriangles(ClippedMesh);
+			RemoveDanglingTriangles(ClippedMesh);
+		}
+
+		// Each element is closed on its own, better to count the overlap twice than to have holes in the shell
+		if (!IsClosedTriangleMesh(ClippedMesh))
+		{
+			UE_LOG(LogWaterPhysics, Warning, TEXT("RemoveInternalTriangles: The clipped collision elements of %s are not closed, keeping the overlapping elements. Their overlap adds to the buoyancy more than once."), DebugName);
+			Mesh.VertexList.SetNum(NumSourceVertices);
+			return;
+		}
+
+		Mesh = MoveTemp(ClippedMesh);
+
+		// Drop vertices which are no longer referenced so that we don't pay for fetching water info for them
+		TArray<int32> VertexRemap;
+		VertexRemap.Init(INDEX_NONE, Mesh.VertexList.Num());
+
+		FVertexList OutVertexList;
+		OutVertexList.Reserve(Mesh.VertexList.Num());
+		for (int32& Index : Mesh.IndexList)
+		{
+			if (VertexRemap[Index] == INDEX_NONE)
+				VertexRemap[Index] = OutVertexList.Add(Mesh.VertexList[Index]);
+			Index = VertexRemap[Index];
+		}
+
+		Mesh.VertexList = MoveTemp(OutVertexList);
 	}
 
-	FWaterSurfaceProvider::FVertexWaterInfoArray FetchVerticesWaterInfo(const UActorComponent* Component, const FVertexList& VertexList, 
-		EWaterInfoFetchingMethod WaterInfoFetchingMethod, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
+	FIndexedTriangleMesh TriangulateWaterPhysicsCollisionSetup(const FWaterPhysicsCollisionSetup& CollisionSetup, const FTriangleSubdivisionSettings& SubdivisionSettings, const TCHAR* DebugName)
 	{
-		FWaterSurfaceProvider::FVertexWaterInfoArray VertexWaterInfo;
+		TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateWaterPhysicsCollisionSetup);
 
-		switch (WaterInfoFetchingMethod)
+		FIndexedTriangleMesh OutTriangulatedMesh;
+
+		// The first triangle of each collision element
+		TArray<int32, TInlineAllocator<16>> ElemTriangleStart;
+
+		const auto BeginElem = [&]() { return ElemTriangleStart.Add(OutTriangulatedMesh.IndexList.Num() / 3); };
+
+		const auto AppendTriangleMesh = [&](const FIndexedTriangleMesh& TriangleMesh)
 		{
-		case EWaterInfoFetchingMethod::WaterSurfaceProvider:
+			AppendOffsetIndices(OutTriangulatedMesh, TriangleMesh.IndexList);
+			OutTriangulatedMesh.VertexList.Append(TriangleMesh.VertexList);
+		};
+
+		// Mesh elements may reference a shared mesh, their transform is applied while copying the vertices
+		const auto CopyMeshElem = [](FIndexedTriangleMesh& OutMesh, const FWaterPhysicsCollisionSetup::FMeshElem& MeshElem)
 		{
-			checkf(WaterSurfaceProvider != nullptr, TEXT("A WaterSurfaceProvider is requred to use this water info fetching mode"));
-			VertexWaterInfo = WaterSurfaceProvider->CalculateVerticesWaterInfo(VertexList, Component, SurfaceGetter);
-			break;
+			const int32 FirstVertex = OutMesh.VertexList.Num();
+			OutMesh.VertexList.Reserve(FirstVertex + MeshElem.Mesh->VertexList.Num());
+			for (int32 i = 0; i < MeshElem.Mesh->VertexList.Num(); i++)
+				OutMesh.VertexList.Add(MeshElem.GetVertex(i));
+
+			OutMesh.IndexList.Reserve(OutMesh.IndexList.Num() + MeshElem.Mesh->IndexList.Num());
+			for (const int32 Index : MeshElem.Mesh->IndexList)
+				OutMesh.IndexList.Add(FirstVertex + Index);
+		};
+
+		// Triangulate each collision setup
+		for (const FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
+		{
+			BeginElem();
+			TriangulateSphereElem(OutTriangulatedMesh, SphereElem.Radius, SphereElem.Center, SubdivisionSettings.Sphere);
 		}
-		case EWaterInfoFetchingMethod::PerVertex:
+
+		for (const FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
 		{
-			VertexWaterInfo.SetNum(VertexList.Num());
-			for (int32 i = 0; i < VertexList.Num(); ++i)
-				VertexWaterInfo[i] = SurfaceGetter.Execute(Component, VertexList[i]);
-			break;
+			BeginElem();
+			AppendTriangleMesh(TriangulateBoxElem(BoxElem.Extent, BoxElem.Center, BoxElem.Rotation, SubdivisionSettings.Box));
 		}
-		case EWaterInfoFetchingMethod::PerObject:
+
+		for (const FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
 		{
-			// Right now we can assume FetchVerticesWaterInfo is only called with a PrimitiveComponent
-			// or a component which implements WaterPhysicsCollisionInterface.
-			const FVector ComponentLocation = Component->Implements<UWaterPhysicsCollisionInterface>()
-				? dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component)->GetWaterPhysicsCollisionWorldTransform(NAME_None).GetLocation()
-				: Cast<USceneComponent>(Component)->GetComponentLocation();
+			BeginElem();
+			TriangulateSphylElem(OutTriangulatedMesh, SphylElem.HalfHeight, SphylElem.Radius, SphylElem.Center, SphylElem.Rotation, SubdivisionSettings.Capsule);
+		}
 
-			VertexWaterInfo.SetNum(VertexList.Num());
-			const FGetWaterInfoResult WaterSurface = SurfaceGetter.Execute(Component, ComponentLocation);
-			for (FGetWaterInfoResult &WaterInfo : VertexWaterInfo)
-				WaterInfo = WaterSurface;
-			break;
+		// Split the mesh triangle budget between the mesh elements relative to their size
+		int32 NumMeshTriangles = 0;
+		for (const FWaterPhysicsCollisionSetup::FMeshElem& MeshElem : CollisionSetup.MeshElems)
+			NumMeshTriangles += MeshElem.NumTriangles();
+
+		const bool bSimplifyMeshes = SubdivisionSettings.MaxMeshTriangles > 0 && NumMeshTriangles > SubdivisionSettings.MaxMeshTriangles;
+
+		// Each element gets its share of what the previous elements left of the budget, so an element ending up below or above 
+		// its share gives to or takes from the following ones, and the total stays within MaxMeshTriangles
+		int32 RemainingMeshTriangles = NumMeshTriangles;
+		int32 RemainingBudget        = SubdivisionSettings.MaxMeshTriangles;
+
+		for (const FWaterPhysicsCollisionSetup::FMeshElem& SourceMeshElem : CollisionSetup.MeshElems)
+		{
+			BeginElem();
+
+			if (!bSimplifyMeshes && SubdivisionSettings.Convex <= 0)
+			{
+				CopyMeshElem(OutTriangulatedMesh, SourceMeshElem);
+				continue;
+			}
+
+			FIndexedTriangleMesh TriangulatedMesh;
+			CopyMeshElem(TriangulatedMesh, SourceMeshElem);
+
+			if (bSimplifyMeshes && SourceMeshElem.NumTriangles() > 0)
+			{
+				const int32 ElemBudget = (int32)((int64)RemainingBudget * SourceMeshElem.NumTriangles() / RemainingMeshTriangles);
+				SimplifyTriangleMesh(TriangulatedMesh, FMath::Max(ElemBudget, 4));
+
+				RemainingMeshTriangles -= SourceMeshElem.NumTriangles();
+				RemainingBudget         = FMath::Max(RemainingBudget - TriangulatedMesh.IndexList.Num() / 3, 0);
+			}
+
+			if (SubdivisionSettings.Convex <= 0)
+			{
+				AppendTriangleMesh(TriangulatedMesh);
+				continue;
+			}
+
+			FTessellationSettings TessellationSettings;
+			TessellationSettings.TessellationMode = EWaterPhysicsTessellationMode::Levels;
+			TessellationSettings.Levels = SubdivisionSettings.Convex;
+			TessellateTriangles(TriangulatedMesh, TessellationSettings);
+
+			AppendTriangleMesh(TriangulatedMesh);
 		}
-		default:
-			checkf(0, TEXT("Water Surface Mode Not Implemented!"));
-			break;
+
+		// The convex elements which can occlude triangles of the other elements, only worth building if there is something to occlude
+		TArray<FConvexOccluder> Occluders;
+		for (int32 ElemIndex = 0; ElemIndex < ElemTriangleStart.Num() && ElemTriangleStart.Num() > 1; ElemIndex++)
+		{
+			const int32 TriangleEnd = ElemIndex + 1 < ElemTriangleStart.Num() ? ElemTriangleStart[ElemIndex + 1] : OutTriangulatedMesh.IndexList.Num() / 3;
+
+			FConvexOccluder Occluder;
+			if (FConvexOccluder::MakeConvexMesh(ElemIndex, OutTriangulatedMesh, ElemTriangleStart[ElemIndex], TriangleEnd, Occluder))
+				Occluders.Add(MoveTemp(Occluder));
 		}
 
-		return VertexWaterInfo;
-	}
-};
+		RemoveInternalTriangles(OutTriangulatedMesh, ElemTriangleStart, Occluders, DebugName);
 
-using namespace WaterPhysics;
+		checkSlow(Algo::AllOf(OutTriangulatedMesh.IndexList, [&](int32 Index) { return Index >= 0 && Index < OutTriangulatedMesh.VertexList.Num(); }));
 
-void FWaterPhysicsScene::StepWaterPhysicsScene(float DeltaTime, const FVector& Gravity, const FWaterPhysicsSettings& SceneSettings, 
-	const FGetWaterInfoAtLocation& SurfaceGetter, bool bSurfaceGetterThreadSafe, FWaterSurfaceProvider* WaterSurfaceProvider, UObject* DebugContext)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(StepWaterPhysics);
-	SCOPED_OBJECT_DATA_CAPTURE(
-		FString::Printf(TEXT("%s.%s"), (DebugContext ? *DebugContext->GetOuter()->GetName() : TEXT("None")), (DebugContext ? *DebugContext->GetName() : TEXT("None"))),
-		TEXT("WaterPhysicsScene")
-	);
+		return OutTriangulatedMesh;
+	}
 
-	// Step 0: Gather up all the bodies we are about to process
-	TArray<TPair<const UActorComponent*, FWaterPhysicsBody*>> BodiesToProcess;
+	FWaterPhysicsCollisionSetup GenerateBodyInstanceWaterPhysicsCollisionSetup_Internal(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies, bool bWorldSpace)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(RemoveInvalidComponents);
+		TRACE_CPUPROFILER_EVENT_SCOPE(GenerateBodyInstanceWaterPhysicsCollisionSetup);
+
+		FWaterPhysicsCollisionSetup OutCollisionSetup;
+
+		// NOTE: AddSphereElem, AddBoxElem, AddSphylElem and AddConvexElem mimics the scaling behaviour of UE4. This scaling is buggy
+		// and has therefore been created to intentionally follow this buggy behaviour.
+		// TODO: This is pretty much copy-pasted in WaterPhysicsMath.cpp, refactor to used shared scaling logic
+
+		const auto AddSphereElem = [&](const FKSphereElem& SphereElem, const FTransform& ParentInstanceWorldTransform, 
+			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+		{
+			const FVector BodyScale3DAbs = BodyScale3D.GetAbs();
+			const float SphereRadius = FMath::Max(SphereElem.Radius * FMath::Min3(BodyScale3DAbs.X, BodyScale3DAbs.Y, BodyScale3DAbs.Z), FCollisionShape::MinSphereRadius());
+			const FTransform SphereWorldTransform = FTransform(FRotator::ZeroRotator, WeldedRelativeTransform.TransformPosition(SphereElem.Center) * ParentBodyScale3D) 
+				* ParentInstanceWorldTransform;
+			OutCollisionSetup.SphereElems.Add({ SphereWorldTransform.GetLocation(), SphereRadius });
+		};
+
+		const auto AddBoxElem = [&](const FKBoxElem& BoxElem, const FTransform& ParentInstanceWorldTransform, 
+			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+		{
+			const FVector BodyScale3DAbs = BodyScale3D.GetAbs();
+			const FVector BoxHalfExtents(
+				FMath::Max(0.5f * BoxElem.X * BodyScale3DAbs.X, FCollisionShape::MinBoxExtent()),
+				FMath::Max(0.5f * BoxElem.Y * BodyScale3DAbs.Y, FCollisionShape::MinBoxExtent()),
+				FMath::Max(0.5f * BoxElem.Z * BodyScale3DAbs.Z, FCollisionShape::MinBoxExtent())
+			);
+			const FTransform BoxWorldTransform = FTransform(
+				WeldedRelativeTransform.TransformRotation(BoxElem.Rotation.Quaternion()),
+				WeldedRelativeTransform.TransformPosition(BoxElem.Center) * ParentBodyScale3D) * ParentInstanceWorldTransform;
+
+			OutCollisionSetup.BoxElems.Add({ BoxWorldTransform.GetLocation(), BoxWorldTransform.Rotator(), BoxHalfExtents });
+		};
+
+		const auto AddSphylElem = [&](const FKSphylElem& SphylElem, const FTransform& ParentInstanceWorldTransform, 
+			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+		{
+			const FVector BodyScale3DAbs   = BodyScale3D.GetAbs();
+			const float   ScaledHalfHeight = (SphylElem.Length + SphylElem.Radius * 2.f) * BodyScale3DAbs.Z * 0.5f;
+			const float   ScaledRadius     = FMath::Max(SphylElem.Radius * FMath::Max(BodyScale3DAbs.X, BodyScale3DAbs.Y), 0.1f);
+			const float   FinalRadius      = FMath::Max(FMath::Min(ScaledRadius, ScaledHalfHeight), FCollisionShape::MinCapsuleRadius());
+			const float   FinalHalfHeight  = FMath::Max(FCollisionShape::MinCapsuleAxisHalfHeight(), ScaledHalfHeight - FinalRadius);
+			const FTransform SphylWorldTransform = FTransform(
+				WeldedRelativeTransform.TransformRotation(SphylElem.Rotation.Quaternion()),
+				WeldedRelativeTransform.TransformPosition(SphylElem.Center) * ParentBodyScale3D) * ParentInstanceWorldTransform;
+			OutCollisionSetup.SphylElems.Add({ SphylWorldTransform.GetLocation(), SphylWorldTransform.Rotator(), FinalRadius, FinalHalfHeight });
+		};
+
+		const auto AddConvexElem = [&](const FKConvexElem& ConvexElem, const FTransform& ParentInstanceWorldTransform, 
+			const FTransform& WeldedRelativeTransform, const FVector& ParentBodyScale3D, const FVector& BodyScale3D)
+		{
+			FTransform LocalConvexElemTransform = ConvexElem.GetTransform();
+			const bool bUseNegX = CalcMeshNegScaleCompensation(BodyScale3D, LocalConvexElemTransform);
+			const FTransform ConvexWorldTransform = FTransform(
+				WeldedRelativeTransform.TransformRotation(LocalConvexElemTransform.GetRotation()),
+				WeldedRelativeTransform.TransformPosition(LocalConvexElemTransform.GetLocation())  * ParentBodyScale3D,
+				BodyScale3D.GetAbs()
+			) * ParentInstanceWorldTransform;
+
+			FWaterPhysicsCollisionSetup::FMeshElem& MeshElem = OutCollisionSetup.MeshElems.Emplace_GetRef(ExtractConvexElemTriangles(ConvexElem, bUseNegX));
+			MeshElem.Transform = ConvexWorldTransform;
+		};
+
+		FBodyInstance* OriginalBodyInstance = BodyInstance;
+		BodyInstance = BodyInstance->WeldParent ? BodyInstance->WeldParent : BodyInstance;
+
+		TArray<FPhysicsShapeHandle> Shapes;
+		FTransform BodyInstanceTransform = FTransform::Identity;
+		FPhysicsCommand::ExecuteRead(BodyInstance->GetPhysicsActorHandle(), [&](const FPhysicsActorHandle& ActorHandle)
+		{
+			BodyInstance->GetAllShapes_AssumesLocked(Shapes);
+			if (bWorldSpace)
+				BodyInstanceTransform = BodyInstance->GetUnrealWorldTransform_AssumesLocked();
+		});
+
+		for (const FPhysicsShapeHandle& Shape : Shapes)
+		{
+			const FBodyInstance* ShapeBodyInstance = BodyInstance->GetOriginalBodyInstance(Shape);
+
+			if (!bIncludeWeldedBodies && ShapeBodyInstance != OriginalBodyInstance)
+				continue;
+
+			const ECollisionShapeType GeomType  = FPhysicsInterface::GetShapeType(Shape);
+			FKShapeElem* const        ShapeElem = FUserData::Get<FKShapeElem>(FPhysicsInterface::GetUserData(Shape));
+
+			if (ShapeElem && !ShapeElem->GetContributeToMass()) // Ignore bodies which are not contributing to mass
+				continue;
+
+			// GetRelativeBodyTransform checks that we are in game thread for no reason, we therefore inline its contents without that check
+			const static auto ThreadedGetRelativeBodyTransform = [](const FBodyInstance* InBodyInstance, const FPhysicsShapeHandle& InShape)->FTransform
+			{
+				const FBodyInstance* BI = InBodyInstance->WeldParent ? InBodyInstance->WeldParent : InBodyInstance;
+				const TMap<FPhysicsShapeHandle, FBodyInstance::FWeldInfo>* ShapeToBodiesMap = BI->GetCurrentWeldInfo();
+				const FBodyInstance::FWeldInfo* Result = ShapeToBodiesMap ? ShapeToBodiesMap->Find(InShape) : nullptr;
+				return Result ? Result->RelativeTM : FTransform::Identity;
+			};
+
+			const FVector    ParentBodyScale3D = BodyInstance->Scale3D;
+			const FVector    ShapeBodyScale3D  = ShapeBodyInstance->Scale3D;
+			const FTransform RelativeBodyTM    = ThreadedGetRelativeBodyTransform(BodyInstance, Shape); // The relative transform between the body and its welded parent (identity if not welded)
+
+			switch (GeomType)
+			{
+			case ECollisionShapeType::Sphere:
+				AddSphereElem(*ShapeElem->GetShapeCheck<FKSphereElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
+				break;
+			case ECollisionShapeType::Box:
+				AddBoxElem(*ShapeElem->GetShapeCheck<FKBoxElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
+				break;
+			case ECollisionShapeType::Capsule:
+				AddSphylElem(*ShapeElem->GetShapeCheck<FKSphylElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
+				break;
+			case ECollisionShapeType::Convex:
+				AddConvexElem(*ShapeElem->GetShapeCheck<FKConvexElem>(), BodyInstanceTransform, RelativeBodyTM, ParentBodyScale3D, ShapeBodyScale3D);
+				break;
+			case ECollisionShapeType::Trimesh:
+				break; // Trimesh cannot simulate physics, cannot support
+			case ECollisionShapeType::Heightfield:
+				break; // Not supported by water physics
+			default:
+				UE_LOG(LogWaterPhysics, Error, TEXT("Triangulate body instance - Unknown geom type."));
+			}
+		}
+
+		return OutCollisionSetup;
+	}
+
+	FWaterPhysicsCollisionSetup GenerateBodyInstanceWaterPhysicsCollisionSetup(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies)
+	{
+		return GenerateBodyInstanceWaterPhysicsCollisionSetup_Internal(BodyInstance, bIncludeWeldedBodies, true);
+	}
+
+	FWaterPhysicsCollisionSetup GenerateBodyInstanceLocalWaterPhysicsCollisionSetup(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies)
+	{
+		return GenerateBodyInstanceWaterPhysicsCollisionSetup_Internal(BodyInstance, bIncludeWeldedBodies, false);
+	}
+
+	// Hash of the collision elements of a body setup, covering everything GenerateBodyInstanceWaterPhysicsCollisionSetup reads from them.
+	// Convex elements are hashed by their vertex buffer rather than its contents, which is reallocated whenever the convex hull is rebuilt.
+	uint32 HashBodySetupCollision(const UBodySetup* BodySetup)
+	{
+		if (!BodySetup)
+			return 0; // Without a BodySetup we have nothing to key the cache on
+
+		uint32 Hash = 0;
+		const auto HashValue = [&Hash](const auto& Value) { Hash = FCrc::MemCrc32(&Value, sizeof(Value), Hash); };
+
+		const FKAggregateGeom& AggGeom = BodySetup->AggGeom;
+		HashValue(AggGeom.SphereElems.Num());
+		HashValue(AggGeom.BoxElems.Num());
+		HashValue(AggGeom.SphylElems.Num());
+		HashValue(AggGeom.ConvexElems.Num());
+
+		for (const FKSphereElem& SphereElem : AggGeom.SphereElems)
+		{
+			HashValue(SphereElem.Center);
+			HashValue(SphereElem.Radius);
+			HashValue(SphereElem.GetContributeToMass());
+		}
+
+		for (const FKBoxElem& BoxElem : AggGeom.BoxElems)
+		{
+			HashValue(BoxElem.Center);
+			HashValue(BoxElem.Rotation);
+			HashValue(BoxElem.X);
+			HashValue(BoxElem.Y);
+			HashValue(BoxElem.Z);
+			HashValue(BoxElem.GetContributeToMass());
+		}
+
+		for (const FKSphylElem& SphylElem : AggGeom.SphylElems)
+		{
+			HashValue(SphylElem.Center);
+			HashValue(SphylElem.Rotation);
+			HashValue(SphylElem.Radius);
+			HashValue(SphylElem.Length);
+			HashValue(SphylElem.GetContributeToMass());
+		}
+
+		// Hashed member by member, FTransform and FBox have padding which is not necessarily initialized
+		for (const FKConvexElem& ConvexElem : AggGeom.ConvexElems)
+		{
+			const FTransform& ElemTransform = ConvexElem.GetTransform();
+			HashValue(ElemTransform.GetTranslation());
+			HashValue(ElemTransform.GetRotation());
+			HashValue(ElemTransform.GetScale3D());
+			HashValue(ConvexElem.ElemBox.Min);
+			HashValue(ConvexElem.ElemBox.Max);
+			HashValue(ConvexElem.VertexData.Num());
+			HashValue(ConvexElem.IndexData.Num());
+			HashValue(ConvexElem.VertexData.GetData());
+			HashValue(ConvexElem.GetContributeToMass());
+		}
+
+		return Hash != 0 ? Hash : 1; // 0 is reserved for "do not cache"
+	}
+
+	void TransformWaterPhysicsCollisionSetup(FWaterPhysicsCollisionSetup& CollisionSetup, const FTransform& Transform)
+	{
+		for (FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
+			TransformSphereElem(SphereElem, Transform);
+
+		for (FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
+			TransformBoxElem(BoxElem, Transform);
+
+		for (FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
+			TransformSphylElem(SphylElem, Transform);
+
+		for (FWaterPhysicsCollisionSetup::FMeshElem& MeshElem : CollisionSetup.MeshElems)
+			TransformMeshElem(MeshElem, Transform);
+	}
+
+	FWaterPhysicsCollisionSetup GenerateLocalWaterPhysicsCollisionSetup(const IWaterPhysicsCollisionInterface* CollisionInterface, const FName& BodyName, const FVector& Scale3D)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GenerateLocalWaterPhysicsCollisionSetup);
+
+		FWaterPhysicsCollisionSetup CollisionSetup = CollisionInterface->GenerateWaterPhysicsCollisionSetup(BodyName);
+
+		// Only apply the scale, the rotation and translation is applied when transforming the triangulated mesh into world space
+		TransformWaterPhysicsCollisionSetup(CollisionSetup, FTransform(FQuat::Identity, FVector::ZeroVector, Scale3D));
+
+		return CollisionSetup;
+	}
+
+	FWaterPhysicsCollisionSetup GenerateWaterPhysicsCollisionSetup(const IWaterPhysicsCollisionInterface* CollisionInterface, const FName& BodyName)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(GenerateWaterPhysicsCollisionSetup);
+
+		FWaterPhysicsCollisionSetup CollisionSetup = CollisionInterface->GenerateWaterPhysicsCollisionSetup(BodyName);
+		const FTransform CollisionTransform = CollisionInterface->GetWaterPhysicsCollisionWorldTransform(BodyName);
+
+		// Transform the Collision Setup to correct world transform
+		TransformWaterPhysicsCollisionSetup(CollisionSetup, CollisionTransform);
+
+		return CollisionSetup;
+	}
+
+	// The transform of a welded body relative to its weld parent, identity if the body is not welded
+	FTransform GetWeldRelativeTransform(const FBodyInstance* BodyInstance)
+	{
+		const TMap<FPhysicsShapeHandle, FBodyInstance::FWeldInfo>* ShapeToBodiesMap = BodyInstance->WeldParent ? BodyInstance->WeldParent->GetCurrentWeldInfo() : nullptr;
+		if (ShapeToBodiesMap == nullptr)
+			return FTransform::Identity;
+
+		// All shapes of a welded body share the same relative transform
+		for (const TPair<FPhysicsShapeHandle, FBodyInstance::FWeldInfo>& WeldInfo : *ShapeToBodiesMap)
+		{
+			if (WeldInfo.Value.ChildBI == BodyInstance)
+				return WeldInfo.Value.RelativeTM;
+		}
+
+		return FTransform::Identity;
+	}
+
+	FTriangleMeshEdges BuildTriangleMeshEdges(TConstArrayView<int32> IndexList)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuildTriangleMeshEdges);
+
+		FTriangleMeshEdges Result;
+		Result.EdgeIndexList.SetNumUninitialized(IndexList.Num());
+
+		FEdgeVertexMap EdgeIds;
+		EdgeIds.Reset(IndexList.Num() / 2); // A closed mesh has 1.5 edges per triangle
+
+		for (int32 i = 0; i < IndexList.Num(); i += 3)
+		{
+			for (int32 j = 0; j < 3; ++j)
+			{
+				const FEdgeKey Edge(IndexList[i + j], IndexList[i + (j + 1) % 3]);
+				Result.EdgeIndexList[i + j] = EdgeIds.FindOrAdd(Edge, [&]() { return Result.NumEdges++; });
+			}
+		}
+
+		return Result;
+	}
+
+	TSharedPtr<const FBodyLocalMesh, ESPMode::ThreadSafe> MakeBodyLocalMesh(FIndexedTriangleMesh&& Mesh, TConstArrayView<int32> TemplateIndexList,
+		TSharedPtr<const FWaterPhysicsCollisionSetup, ESPMode::ThreadSafe> PrimitiveCollisionSetup)
+	{
+		TSharedPtr<FBodyLocalMesh, ESPMode::ThreadSafe> LocalMesh = MakeShared<FBodyLocalMesh, ESPMode::ThreadSafe>();
+		LocalMesh->PrimitiveCollisionSetup = MoveTemp(PrimitiveCollisionSetup);
+		LocalMesh->VertexList              = MoveTemp(Mesh.VertexList);
+		LocalMesh->OwnedIndexList          = MoveTemp(Mesh.IndexList);
+		LocalMesh->IndexList               = TemplateIndexList.Num() > 0 ? TemplateIndexList : TConstArrayView<int32>(LocalMesh->OwnedIndexList);
+
+		const FVertexList&           VertexList = LocalMesh->VertexList;
+		const TConstArrayView<int32> IndexList  = LocalMesh->IndexList;
+
+		LocalMesh->Edges = BuildTriangleMeshEdges(IndexList);
+
+		if (VertexList.Num() > 0)
+		{
+			const FBox Bounds(VertexList.GetData(), VertexList.Num());
+			LocalMesh->Bounds = FSphere(Bounds.GetCenter(), Bounds.GetExtent().Size());
+		}
+
+		TArray<uint8> EdgeUseCount;
+		EdgeUseCount.SetNumZeroed(LocalMesh->Edges.NumEdges);
+		for (const int32 EdgeIndex : LocalMesh->Edges.EdgeIndexList)
+			EdgeUseCount[EdgeIndex] = FMath::Min(EdgeUseCount[EdgeIndex] + 1, 3);
+
+		LocalMesh->bClosed = EdgeUseCount.Num() > 0 && Algo::AllOf(EdgeUseCount, [](uint8 Count) { return Count == 2; });
+
+		// Divergence theorem, sum the signed volumes of the tetrahedrons formed by each triangle and the bounds center
+		if (LocalMesh->bClosed)
+		{
+			const FVector Origin = LocalMesh->Bounds.Center;
+
+			double  Volume      = 0.0;
+			FVector WeightedSum = FVector::ZeroVector;
+			for (int32 i = 0; i < IndexList.Num(); i += 3)
+			{
+				const FVector A = VertexList[IndexList[i + 0]] - Origin;
+				const FVector B = VertexList[IndexList[i + 1]] - Origin;
+				const FVector C = VertexList[IndexList[i + 2]] - Origin;
+
+				const double TetVolume = FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 6.0;
+				Volume      += TetVolume;
+				WeightedSum += (A + B + C) * (TetVolume / 4.0);
+			}
+
+			// Triangle normals point outwards which gives a positive volume, anything else is not a proper closed mesh
+			if (Volume > UE_KINDA_SMALL_NUMBER)
+			{
+				LocalMesh->Volume   = (float)Volume;
+				LocalMesh->Centroid = Origin + WeightedSum / Volume;
+			}
+			else
+			{
+				LocalMesh->bClosed = false;
+			}
+		}
+
+		LocalMesh->VertexX.Reserve(VertexList.Num());
+		LocalMesh->VertexY.Reserve(VertexList.Num());
+		LocalMesh->VertexZ.Reserve(VertexList.Num());
+		for (const FVector& Vertex : VertexList)
+		{
+			LocalMesh->VertexX.Add((float)Vertex.X);
+			LocalMesh->VertexY.Add((float)Vertex.Y);
+			LocalMesh->VertexZ.Add((float)Vertex.Z);
+		}
+
+		return LocalMesh;
+	}
+
+	// Vertex of the cached body mesh in the precision the step runs at
+	template<typename FVec> FVec GetLocalVertex(const FBodyLocalMesh& LocalMesh, int32 VertexIndex);
+
+	template<> FORCEINLINE FVector GetLocalVertex<FVector>(const FBodyLocalMesh& LocalMesh, int32 VertexIndex)
+	{
+		return LocalMesh.VertexList[VertexIndex];
+	}
+	template<> FORCEINLINE FVector3f GetLocalVertex<FVector3f>(const FBodyLocalMesh& LocalMesh, int32 VertexIndex)
+	{
+		return FVector3f(LocalMesh.VertexX[VertexIndex], LocalMesh.VertexY[VertexIndex], LocalMesh.VertexZ[VertexIndex]);
+	}
+
+	// VertexDepths and SubmergedMask are the output of CalcVertexWaterDepths for the vertices of LocalMesh
+	template<typename FVec>
+	TSubmergedTriangleArray<FVec> PerformTriangleMeshWaterIntersection(const FWaterSurfaceProvider::FVertexWaterInfoArray& VertexWaterInfo, const FBodyLocalMesh& LocalMesh,
+		const TInlineFrameArray<float, InlineAllocSize()>& VertexDepths, const TInlineFrameArray<uint32, InlineAllocSize() / 32>& SubmergedMask)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PerformTriangleMeshWaterIntersection);
+
+		typedef typename TSubmergedTriangleArray<FVec>::FVertex FVertex;
+
+		const FTriangleMeshEdges& TriangleMeshEdges = LocalMesh.Edges;
+
+		TSubmergedTriangleArray<FVec> Result;
+
+		const int32 NumVertices = LocalMesh.VertexList.Num();
+		check(VertexWaterInfo.Num() == NumVertices && VertexDepths.Num() == NumVertices);
+
+		const auto IsSubmerged = [&](int32 VertexIndex) { return (SubmergedMask[VertexIndex >> 5] & (1u << (VertexIndex & 31))) != 0; };
+
+		TInlineFrameArray<int32, InlineAllocSize()> VertexSubmergedIndex;
+		VertexSubmergedIndex.SetNumUninitialized(NumVertices);
+
+		for (int32 Word = 0; Word < SubmergedMask.Num(); ++Word)
+		{
+			for (uint32 Bits = SubmergedMask[Word]; Bits != 0; Bits &= Bits - 1)
+			{
+				const int32 i = Word * 32 + FMath::CountTrailingZeros(Bits);
+				VertexSubmergedIndex[i] = Result.VertexList.Emplace(FVertex{ GetLocalVertex<FVec>(LocalMesh, i), FVec(VertexWaterInfo[i].WaterVelocity), -VertexDepths[i], FVec(VertexWaterInfo[i].WaterSurfaceNormal) });
+			}
+		}
+
+		check(TriangleMeshEdges.EdgeIndexList.Num() == LocalMesh.IndexList.Num());
+
+		// Vertex created on each edge crossing the surface, shared between the two triangles of the edge
+		TFrameArray<int32> EdgeSplitVertices;
+		EdgeSplitVertices.SetNumUninitialized(TriangleMeshEdges.NumEdges);
+		FMemory::Memset(EdgeSplitVertices.GetData(), 0xFF, EdgeSplitVertices.Num() * sizeof(int32)); // INDEX_NONE
+
+		struct FVertexIndex
+		{
+			int32 Index;
+			int32 VertexOrderIndex; // Order on triangle (0/1/2)
+		};
+
+		const auto FindOrAddSplitVertex = [&](int32 TriangleStart, const FVertexIndex& A, const FVertexIndex& B, auto&& CreateVertex)->int32
+		{
+			// Edge j goes from corner j to corner j + 1
+			const int32 Corner = (A.VertexOrderIndex + 1) % 3 == B.VertexOrderIndex ? A.VertexOrderIndex : B.VertexOrderIndex;
+			int32& SplitVertex = EdgeSplitVertices[TriangleMeshEdges.EdgeIndexList[TriangleStart + Corner]];
+			if (SplitVertex == INDEX_NONE)
+				SplitVertex = CreateVertex();
+			return SplitVertex;
+		};
+
+		TArray<FVertexIndex, TInlineAllocator<3>> VerticesOverSurface;
+		TArray<FVertexIndex, TInlineAllocator<3>> VerticesUnderSurface;
+		for (int32 i = 0; i < LocalMesh.IndexList.Num(); i+=3)
+		{
+			VerticesOverSurface.Empty(3);
+			VerticesUnderSurface.Empty(3);
+
+			for (int32 j = 0; j < 3; j++)
+			{
+				const int32 VertexIndex = LocalMesh.IndexList[i + j];
+				(IsSubmerged(VertexIndex) ? VerticesUnderSurface : VerticesOverSurface).Add({ VertexIndex, j });
+			}
+
+			if (VerticesUnderSurface.Num() == 3)
+			{   // Entire triangle is submerged
+				Result.EmplaceTriangle(FSubmergedTriangle{
+					{ VertexSubmergedIndex[LocalMesh.IndexList[i + 0]],
+						VertexSubmergedIndex[LocalMesh.IndexList[i + 1]],
+						VertexSubmergedIndex[LocalMesh.IndexList[i + 2]] },
+					i / 3
+				});
+			}
+			else if (VerticesOverSurface.Num() != 3) // Split partially submerged triangle
+			{
+				const FVertexIndex& A = VerticesOverSurface.Num() == 2 ? VerticesUnderSurface[0] : VerticesOverSurface[0];
+				const FVertexIndex& B = VerticesOverSurface.Num() == 2 ? VerticesOverSurface[0] : VerticesUnderSurface[0];
+				const FVertexIndex& C = VerticesOverSurface.Num() == 2 ? VerticesOverSurface[1] : VerticesUnderSurface[1];
+
+				const float AAbsVertextDepth = FMath::Abs(VertexDepths[A.Index]);
+				const float BAbsVertextDepth = FMath::Abs(VertexDepths[B.Index]);
+				const float CAbsVertextDepth = FMath::Abs(VertexDepths[C.Index]);
+
+				const float ABSplitAlpha = AAbsVertextDepth / (AAbsVertextDepth + BAbsVertextDepth);
+				const float ACSplitAlpha = AAbsVertextDepth / (AAbsVertextDepth + CAbsVertextDepth);
+
+				const int32 ABIndex = FindOrAddSplitVertex(i, A, B, [&]()
+				{
+					return Result.VertexList.Emplace(FVertex{
+						FMath::Lerp(GetLocalVertex<FVec>(LocalMesh, A.Index), GetLocalVertex<FVec>(LocalMesh, B.Index), ABSplitAlpha),
+						FVec(FMath::Lerp(VertexWaterInfo[A.Index].WaterVelocity, VertexWaterInfo[B.Index].WaterVelocity, ABSplitAlpha)),
+						0.f,
+						FVec(FMath::Lerp(VertexWaterInfo[A.Index].WaterSurfaceNormal, VertexWaterInfo[B.Index].WaterSurfaceNormal, ABSplitAlpha).GetSafeNormal())
+					});
+				});
+
+				const int32 ACIndex = FindOrAddSplitVertex(i, A, C, [&]()
+				{
+					return Result.VertexList.Emplace(FVertex{
+						FMath::Lerp(GetLocalVertex<FVec>(LocalMesh, A.Index), GetLocalVertex<FVec>(LocalMesh, C.Index), ACSplitAlpha),
+						FVec(FMath::Lerp(VertexWaterInfo[A.Index].WaterVelocity, VertexWaterInfo[C.Index].WaterVelocity, ACSplitAlpha)),
+						0.f,
+						FVec(FMath::Lerp(VertexWaterInfo[A.Index].WaterSurfaceNormal, VertexWaterInfo[C.Index].WaterSurfaceNormal, ACSplitAlpha).GetSafeNormal())
+					});
+				});
+
+				if (VerticesOverSurface.Num() == 2)
+				{
+					const int32 Indices[3] = { VertexSubmergedIndex[A.Index], ABIndex, ACIndex };
+					Result.EmplaceTriangle(FSubmergedTriangle{
+						{ Indices[A.VertexOrderIndex], Indices[B.VertexOrderIndex], Indices[C.VertexOrderIndex] }, 
+						i / 3
+					});
+				}
+				else
+				{
+					const int32 Indices1[3] = { ABIndex, VertexSubmergedIndex[B.Index], VertexSubmergedIndex[C.Index] }; 
+					Result.EmplaceTriangle(FSubmergedTriangle{
+						{ Indices1[A.VertexOrderIndex], Indices1[B.VertexOrderIndex], Indices1[C.VertexOrderIndex] }, 
+						i / 3
+					});
+
+					const int32 Indices2[3] = { ABIndex, ACIndex, VertexSubmergedIndex[C.Index] };
+					Result.EmplaceTriangle(FSubmergedTriangle{
+						{ Indices2[B.VertexOrderIndex], Indices2[A.VertexOrderIndex], Indices2[C.VertexOrderIndex] }, 
+						i / 3
+					});
+				}
+			}
+		}
+
+		return Result;
+	}
+
+	FWaterSurfaceProvider::FVertexWaterInfoArray FetchVerticesWaterInfo(const UActorComponent* Component, const FVertexList& VertexList, 
+		EWaterInfoFetchingMethod WaterInfoFetchingMethod, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
+	{
+		FWaterSurfaceProvider::FVertexWaterInfoArray VertexWaterInfo;
+
+		switch (WaterInfoFetchingMethod)
+		{
+		case EWaterInfoFetchingMethod::WaterSurfaceProvider:
+		{
+			checkf(WaterSurfaceProvider != nullptr, TEXT("A WaterSurfaceProvider is requred to use this water info fetching mode"));
+			VertexWaterInfo = WaterSurfaceProvider->CalculateVerticesWaterInfo(VertexList, Component, SurfaceGetter);
+			break;
+		}
+		case EWaterInfoFetchingMethod::PerVertex:
+		{
+			VertexWaterInfo.SetNum(VertexList.Num());
+			for (int32 i = 0; i < VertexList.Num(); ++i)
+				VertexWaterInfo[i] = SurfaceGetter.Execute(Component, VertexList[i]);
+			break;
+		}
+		case EWaterInfoFetchingMethod::PerObject:
+		{
+			// Right now we can assume FetchVerticesWaterInfo is only called with a PrimitiveComponent
+			// or a component which implements WaterPhysicsCollisionInterface.
+			const FVector ComponentLocation = Component->Implements<UWaterPhysicsCollisionInterface>()
+				? dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component)->GetWaterPhysicsCollisionWorldTransform(NAME_None).GetLocation()
+				: Cast<USceneComponent>(Component)->GetComponentLocation();
+
+			VertexWaterInfo.SetNum(VertexList.Num());
+			const FGetWaterInfoResult WaterSurface = SurfaceGetter.Execute(Component, ComponentLocation);
+			for (FGetWaterInfoResult &WaterInfo : VertexWaterInfo)
+				WaterInfo = WaterSurface;
+			break;
+		}
+		default:
+			checkf(0, TEXT("Water Surface Mode Not Implemented!"));
+			break;
+		}
+
+		return VertexWaterInfo;
+	}
+
+	// World space positions of body space vertices, only the water surface query needs them
+	FVertexList TransformVerticesToWorld(const FVertexList& LocalVertices, const FTransform& BodyTransform)
+	{
+		FVertexList WorldVertices;
+		WorldVertices.SetNumUninitialized(LocalVertices.Num());
+		for (int32 i = 0; i < LocalVertices.Num(); ++i)
+			WorldVertices[i] = BodyTransform.TransformPositionNoScale(LocalVertices[i]);
+		return WorldVertices;
+	}
+
+	// Moves water info returned by the surface getter into the space of the body
+	FORCEINLINE FGetWaterInfoResult WaterInfoToBodySpace(const FGetWaterInfoResult& WaterInfo, const FTransform& BodyTransform)
+	{
+		FGetWaterInfoResult Result;
+		Result.WaterSurfaceLocation = BodyTransform.InverseTransformPositionNoScale(WaterInfo.WaterSurfaceLocation);
+		Result.WaterSurfaceNormal   = BodyTransform.InverseTransformVectorNoScale(WaterInfo.WaterSurfaceNormal);
+		Result.WaterVelocity        = BodyTransform.InverseTransformVectorNoScale(WaterInfo.WaterVelocity);
+		return Result;
+	}
+
+	// Every triangle of a body which is entirely below the water, with the depths taken from the single water sample above it
+	template<typename FVec>
+	TSubmergedTriangleArray<FVec> MakeSubmergedTriangleArray(const FGetWaterInfoResult& WaterInfo, const FBodyLocalMesh& LocalMesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(MakeSubmergedTriangleArray);
+
+		const FVec SurfaceLocation = FVec(WaterInfo.WaterSurfaceLocation);
+		const FVec SurfaceNormal   = FVec(WaterInfo.WaterSurfaceNormal);
+		const FVec WaterVelocity   = FVec(WaterInfo.WaterVelocity);
+
+		TSubmergedTriangleArray<FVec> Result;
+
+		Result.VertexList.SetNumUninitialized(LocalMesh.VertexList.Num());
+		for (int32 i = 0; i < LocalMesh.VertexList.Num(); ++i)
+		{
+			const FVec Position = GetLocalVertex<FVec>(LocalMesh, i);
+			Result.VertexList[i] = typename TSubmergedTriangleArray<FVec>::FVertex{ 
+				Position, 
+				WaterVelocity, 
+				FMath::Max(0.f, (float)FVec::DotProduct(SurfaceLocation - Position, SurfaceNormal)), 
+				SurfaceNormal 
+			};
+		}
+
+		Result.TriangleList.SetNumUninitialized(LocalMesh.IndexList.Num() / 3);
+		for (int32 i = 0; i < Result.TriangleList.Num(); ++i)
+		{
+			Result.TriangleList[i] = FSubmergedTriangle{ 
+				{ LocalMesh.IndexList[i * 3 + 0], LocalMesh.IndexList[i * 3 + 1], LocalMesh.IndexList[i * 3 + 2] }, 
+				i 
+			};
+		}
+
+		return Result;
+	}
+
+	// Bounding sphere of a collision setup made of spheres, boxes and capsules
+	FSphere CalcPrimitiveCollisionBounds(const FWaterPhysicsCollisionSetup& CollisionSetup)
+	{
+		FBox Bounds(ForceInit);
+		for (const FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
+			Bounds += FBox::BuildAABB(SphereElem.Center, FVector(SphereElem.Radius));
+
+		for (const FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
+			Bounds += FBox::BuildAABB(BoxElem.Center, FVector(BoxElem.Extent.Size()));
+
+		for (const FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
+			Bounds += FBox::BuildAABB(SphylElem.Center, FVector(SphylElem.HalfHeight + SphylElem.Radius));
+
+		return FSphere(Bounds.GetCenter(), Bounds.GetExtent().Size());
+	}
+
+	// Fits a plane to the sampled water surface, fails if any of the samples deviate more than MaxDeviation (cm) from the plane
+	bool FitWaterPlane(const FWaterSurfaceProvider::FVertexWaterInfoArray& VertexWaterInfo, float MaxDeviation, FPlane& OutWaterPlane, FVector& OutWaterVelocity)
+	{
+		if (VertexWaterInfo.Num() == 0)
+			return false;
+
+		FVector AvgLocation = FVector::ZeroVector;
+		FVector AvgNormal   = FVector::ZeroVector;
+		OutWaterVelocity    = FVector::ZeroVector;
+		for (const FGetWaterInfoResult& WaterInfo : VertexWaterInfo)
+		{
+			AvgLocation      += WaterInfo.WaterSurfaceLocation;
+			AvgNormal        += WaterInfo.WaterSurfaceNormal;
+			OutWaterVelocity += WaterInfo.WaterVelocity;
+		}
+		AvgLocation      /= VertexWaterInfo.Num();
+		OutWaterVelocity /= VertexWaterInfo.Num();
+
+		if (!AvgNormal.Normalize())
+			return false;
+
+		OutWaterPlane = FPlane(AvgLocation, AvgNormal);
+
+		for (const FGetWaterInfoResult& WaterInfo : VertexWaterInfo)
+		{
+			if (FMath::Abs(OutWaterPlane.PlaneDot(WaterInfo.WaterSurfaceLocation)) > MaxDeviation 
+				|| FVector::DotProduct(WaterInfo.WaterSurfaceNormal, AvgNormal) < 0.99f)
+				return false;
+		}
+
+		return true;
+	}
+
+	// Limits the drag force so it can at most stop the body this step, never push it in the other direction
+	void ClampDragForce(FForce& DragForce, float DeltaTime, float BodyMass, const FVector& BodyInertiaTensor, const FQuat& BodyRotation, 
+		const FVector& BodyLinearVelocity, const FVector& BodyAngularVelocity)
+	{
+		const static auto ClampForce = [](FVector& InForce, const FVector& InMaxForce)
+		{
+			InForce.X = InForce.X > 0.f 
+				? FMath::Min(InForce.X, FMath::Max(0.f, -InMaxForce.X))
+				: FMath::Max(InForce.X, FMath::Min(0.f, -InMaxForce.X));
+			InForce.Y = InForce.Y > 0.f 
+				? FMath::Min(InForce.Y, FMath::Max(0.f, -InMaxForce.Y))
+				: FMath::Max(InForce.Y, FMath::Min(0.f, -InMaxForce.Y));
+			InForce.Z = InForce.Z > 0.f 
+				? FMath::Min(InForce.Z, FMath::Max(0.f, -InMaxForce.Z))
+				: FMath::Max(InForce.Z, FMath::Min(0.f, -InMaxForce.Z));
+		};
+
+		const FVector BodyLinearMomentum  = BodyMass * BodyLinearVelocity / DeltaTime;
+		const FVector WorldSpaceTensor    = [&]()
+		{
+			const auto TensorMatrix        = FMatrix(FVector(BodyInertiaTensor.X, 0, 0), FVector(0, BodyInertiaTensor.Y, 0), FVector(0, 0, BodyInertiaTensor.Z), FVector(0, 0, 0));
+			const auto RotationMatrix      = FRotationMatrix::Make(BodyRotation);
+			const auto RotatedTensorMatrix = RotationMatrix * TensorMatrix * RotationMatrix.Inverse();
+			return FVector(RotatedTensorMatrix.M[0][0], RotatedTensorMatrix.M[1][1], RotatedTensorMatrix.M[2][2]);
+		}();
+		const FVector BodyAngularMomentum = WorldSpaceTensor * BodyAngularVelocity / DeltaTime;
+
+		// Clamp Linear and angular forces
+		ClampForce(DragForce.Force, BodyLinearMomentum);
+		ClampForce(DragForce.Torque, BodyAngularMomentum);
+	}
+
+	// Triangles per task when a large body is split up. Fixed, so the partial sums and with them the result do not depend on the number of workers.
+	static constexpr int32 ParallelTriangleRangeSize() { return 2048; }
+
+	int32 GetNumTriangleRanges(int32 NumTriangles, int32 ParallelTriangleThreshold)
+	{
+		return ParallelTriangleThreshold > 0 && NumTriangles >= ParallelTriangleThreshold 
+			? FMath::DivideAndRoundUp(NumTriangles, ParallelTriangleRangeSize()) 
+			: 1;
+	}
+
+	// Calls Func(RangeIndex, FirstTriangle, EndTriangle) for each range, from parallel tasks if there is more than one
+	template<typename TFunc>
+	void ForEachTriangleRange(int32 NumTriangles, int32 NumRanges, const TFunc& Func)
+	{
+		if (NumRanges > 1)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(ParallelTriangleRanges);
+
+			FWaterPhysicsFrameArena* FrameArena = FWaterPhysicsFrameArena::GetCurrent();
+			ParallelFor(NumRanges, [&](int32 RangeIndex)
+			{
+				FWaterPhysicsFrameArena::FScope FrameArenaScope(FrameArena);
+				const int32 FirstTriangle = RangeIndex * ParallelTriangleRangeSize();
+				Func(RangeIndex, FirstTriangle, FMath::Min(FirstTriangle + ParallelTriangleRangeSize(), NumTriangles));
+			});
+		}
+		else
+		{
+			Func(0, 0, NumTriangles);
+		}
+	}
+
+	typedef FWaterPhysicsScene::FTriangleDataSoA FTriangleDataSoA;
+
+	// Runs Kernel(FirstTriangle, EndTriangle) over the triangle ranges of a SoA, ranges are a multiple of four. The partial forces are 
+	// summed in range order, so the result does not depend on which task finishes first.
+	template<typename TKernel>
+	FForce SumForceKernelRanges(const FTriangleDataSoA& SoA, int32 ParallelTriangleThreshold, const TKernel& Kernel)
+	{
+		static_assert(ParallelTriangleRangeSize() % 4 == 0, "The SIMD kernels process four triangles at a time");
+
+		const int32 NumRanges = GetNumTriangleRanges(SoA.Num, ParallelTriangleThreshold);
+
+		TInlineFrameArray<FForce, 16> PartialForces;
+		PartialForces.Init(FForce(ForceInit), NumRanges);
+		ForEachTriangleRange(SoA.Num, NumRanges, [&](int32 RangeIndex, int32 FirstTriangle, int32 EndTriangle)
+		{
+			PartialForces[RangeIndex] = Kernel(FirstTriangle, EndTriangle);
+		});
+
+		FForce Result = PartialForces[0];
+		for (int32 i = 1; i < NumRanges; ++i)
+			Result += PartialForces[i];
+
+		return Result;
+	}
+
+	// Force and torque sums of four triangles at a time, reduced to a single FForce at the end
+	struct FForceAccumulator4
+	{
+		VectorRegister4Float Force[3]  = { VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat() };
+		VectorRegister4Float Torque[3] = { VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat() };
+		#if WITH_WATER_PHYS_DEBUG
+		VectorRegister4Float WeightedLocation[3] = { VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat() };
+		VectorRegister4Float Weight              = VectorZeroFloat();
+		#endif
+
+		FORCEINLINE void Add(const FTriangleDataSoA& SoA, int32 Index, const VectorRegister4Float& FX, const VectorRegister4Float& FY, const VectorRegister4Float& FZ)
+		{
+			const VectorRegister4Float RX = SoA.Load(FTriangleDataSoA::CentroidX, Index);
+			const VectorRegister4Float RY = SoA.Load(FTriangleDataSoA::CentroidY, Index);
+			const VectorRegister4Float RZ = SoA.Load(FTriangleDataSoA::CentroidZ, Index);
+
+			Force[0] = VectorAdd(Force[0], FX);
+			Force[1] = VectorAdd(Force[1], FY);
+			Force[2] = VectorAdd(Force[2], FZ);
+
+			// Centroid x Force
+			Torque[0] = VectorAdd(Torque[0], VectorSubtract(VectorMultiply(RY, FZ), VectorMultiply(RZ, FY)));
+			Torque[1] = VectorAdd(Torque[1], VectorSubtract(VectorMultiply(RZ, FX), VectorMultiply(RX, FZ)));
+			Torque[2] = VectorAdd(Torque[2], VectorSubtract(VectorMultiply(RX, FY), VectorMultiply(RY, FX)));
+
+			#if WITH_WATER_PHYS_DEBUG
+			const VectorRegister4Float Size = VectorSqrt(VectorMultiplyAdd(FX, FX, VectorMultiplyAdd(FY, FY, VectorMultiply(FZ, FZ))));
+			WeightedLocation[0] = VectorMultiplyAdd(RX, Size, WeightedLocation[0]);
+			WeightedLocation[1] = VectorMultiplyAdd(RY, Size, WeightedLocation[1]);
+			WeightedLocation[2] = VectorMultiplyAdd(RZ, Size, WeightedLocation[2]);
+			Weight              = VectorAdd(Weight, Size);
+			#endif
+		}
+
+		FForce Reduce(const FVector& BodyCenterOfMass) const
+		{
+			const auto Sum = [](const VectorRegister4Float& V)
+			{
+				alignas(16) float Lanes[4];
+				VectorStoreAligned(V, Lanes);
+				return (double)Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+			};
+
+			FForce Result(ForceInit);
+			Result.Force  = FVector(Sum(Force[0]), Sum(Force[1]), Sum(Force[2]));
+			Result.Torque = FVector(Sum(Torque[0]), Sum(Torque[1]), Sum(Torque[2]));
+			#if WITH_WATER_PHYS_DEBUG
+			const double TotalWeight = Sum(Weight);
+			Result.AvgLocation = TotalWeight > 0.0 
+				? BodyCenterOfMass + FVector(Sum(WeightedLocation[0]), Sum(WeightedLocation[1]), Sum(WeightedLocation[2])) / TotalWeight 
+				: BodyCenterOfMass;
+			#endif
+
+			checkf(Result.IsValid(), TEXT("Invalid force: Force: %s, Torque: %s"), *Result.Force.ToString(), *Result.Torque.ToString());
+			return Result;
+		}
+	};
+
+	// Gravity * AvgDepth * Area * FluidDensity * Normal
+	FForce CalcBuoyancyForce_SIMD(const FTriangleDataSoA& SoA, int32 FirstTriangle, int32 EndTriangle, const FVector& Gravity, float FluidDensity, const FVector& BodyCenterOfMass)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CalcBuoyancyForce_SIMD);
+
+		// NOTE: Gravity and the normal are multiplied component wise
+		const VectorRegister4Float GX = VectorSetFloat1(Gravity.X * FluidDensity);
+		const VectorRegister4Float GY = VectorSetFloat1(Gravity.Y * FluidDensity);
+		const VectorRegister4Float GZ = VectorSetFloat1(Gravity.Z * FluidDensity);
+
+		FForceAccumulator4 Accumulator;
+		for (int32 i = FirstTriangle; i < EndTriangle; i += 4)
+		{
+			const VectorRegister4Float Scale = VectorMultiply(SoA.Load(FTriangleDataSoA::AvgDepth, i), SoA.Load(FTriangleDataSoA::Area, i));
+			Accumulator.Add(SoA, i, 
+				VectorMultiply(VectorMultiply(GX, Scale), SoA.Load(FTriangleDataSoA::NormalX, i)),
+				VectorMultiply(VectorMultiply(GY, Scale), SoA.Load(FTriangleDataSoA::NormalY, i)),
+				VectorMultiply(VectorMultiply(GZ, Scale), SoA.Load(FTriangleDataSoA::NormalZ, i)));
+		}
+		return Accumulator.Reduce(BodyCenterOfMass);
+	}
+
+	// ResistanceScale * Area * -TangentalVelocityNormal * VelocitySize^2, which is -ResistanceScale * Area * VelocitySize * TangentalVelocity
+	FForce CalcViscousResistanceForce_SIMD(const FTriangleDataSoA& SoA, int32 FirstTriangle, int32 EndTriangle, float ResistanceScale, const FVector& BodyCenterOfMass)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CalcViscousResistanceForce_SIMD);
+
+		const VectorRegister4Float NegativeScale = VectorSetFloat1(-ResistanceScale);
+
+		FForceAccumulator4 Accumulator;
+		for (int32 i = FirstTriangle; i < EndTriangle; i += 4)
+		{
+			const VectorRegister4Float NX = SoA.Load(FTriangleDataSoA::NormalX, i);
+			const VectorRegister4Float NY = SoA.Load(FTriangleDataSoA::NormalY, i);
+			const VectorRegister4Float NZ = SoA.Load(FTriangleDataSoA::NormalZ, i);
+			const VectorRegister4Float VX = SoA.Load(FTriangleDataSoA::VelocityX, i);
+			const VectorRegister4Float VY = SoA.Load(FTriangleDataSoA::VelocityY, i);
+			const VectorRegister4Float VZ = SoA.Load(FTriangleDataSoA::VelocityZ, i);
+
+			const VectorRegister4Float VDotN = VectorMultiplyAdd(VX, NX, VectorMultiplyAdd(VY, NY, VectorMultiply(VZ, NZ)));
+			const VectorRegister4Float Scale = VectorMultiply(NegativeScale, VectorMultiply(SoA.Load(FTriangleDataSoA::Area, i), SoA.Load(FTriangleDataSoA::VelocitySize, i)));
+
+			Accumulator.Add(SoA, i,
+				VectorMultiply(Scale, VectorSubtract(VX, VectorMultiply(VDotN, NX))),
+				VectorMultiply(Scale, VectorSubtract(VY, VectorMultiply(VDotN, NY))),
+				VectorMultiply(Scale, VectorSubtract(VZ, VectorMultiply(VDotN, NZ))));
+		}
+		return Accumulator.Reduce(BodyCenterOfMass);
+	}
+
+	FForce CalcPressureDragForce_SIMD(const FTriangleDataSoA& SoA, int32 FirstTriangle, int32 EndTriangle, const FWaterPhysicsSettings& Settings, const FVector& BodyCenterOfMass)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CalcPressureDragForce_SIMD);
+
+		// Pressure on triangles moving into the water, suction on those moving away from it
+		const VectorRegister4Float PressureC1  = VectorSetFloat1(-Settings.PressureCoefficientOfLinearSpeed * 100.f /* N -> cN */);
+		const VectorRegister4Float PressureC2  = VectorSetFloat1(-Settings.PressureCoefficientOfExponentialSpeed * 100.f /* N -> cN */);
+		const VectorRegister4Float PressureF   = VectorSetFloat1(Settings.PressureAngularDependence);
+		const VectorRegister4Float SuctionC1   = VectorSetFloat1(Settings.SuctionCoefficientOfLinearSpeed * 100.f /* N -> cN */);
+		const VectorRegister4Float SuctionC2   = VectorSetFloat1(Settings.SuctionCoefficientOfExponentialSpeed * 100.f /* N -> cN */);
+		const VectorRegister4Float SuctionF    = VectorSetFloat1(Settings.SuctionAngularDependence);
+		const VectorRegister4Float InvRefSpeed = VectorSetFloat1(1.f / Settings.DragReferenceSpeed);
+
+		FForceAccumulator4 Accumulator;
+		for (int32 i = FirstTriangle; i < EndTriangle; i += 4)
+		{
+			const VectorRegister4Float Dot       = SoA.Load(FTriangleDataSoA::VelocityNormalDot, i);
+			const VectorRegister4Float bPressure = VectorCompareGT(Dot, VectorZeroFloat());
+			const VectorRegister4Float Ratio     = VectorMultiply(SoA.Load(FTriangleDataSoA::VelocitySize, i), InvRefSpeed);
+
+			const VectorRegister4Float C1 = VectorSelect(bPressure, PressureC1, SuctionC1);
+			const VectorRegister4Float C2 = VectorSelect(bPressure, PressureC2, SuctionC2);
+			const VectorRegister4Float F  = VectorSelect(bPressure, PressureF, SuctionF);
+
+			const VectorRegister4Float Scale = VectorMultiply(
+				VectorMultiply(VectorMultiplyAdd(C2, VectorMultiply(Ratio, Ratio), VectorMultiply(C1, Ratio)), SoA.Load(FTriangleDataSoA::Area, i)),
+				VectorFastPow(VectorAbs(Dot), F));
+
+			Accumulator.Add(SoA, i,
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::NormalX, i)),
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::NormalY, i)),
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::NormalZ, i)));
+		}
+		return Accumulator.Reduce(BodyCenterOfMass);
+	}
+
+	FForce CalcSlammingForce_SIMD(const FTriangleDataSoA& SoA, int32 FirstTriangle, int32 EndTriangle, const TArray<FWaterPhysicsScene::FPersistentTriangleData>& CurrentFrame,
+		const TArray<FWaterPhysicsScene::FPersistentTriangleData>& PreviousFrame, const FWaterPhysicsSettings& Settings, float BodyMass, float TotalBodyArea, 
+		float DeltaTime, const FVector& BodyCenterOfMass)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CalcSlammingForce_SIMD);
+
+		// FMath::Pow of a negative acceleration is NaN for fractional exponents, which FMath::Clamp turns into full slamming force
+		const bool  bIntegerExponent  = Settings.SlammingForceExponent == FMath::RoundToFloat(Settings.SlammingForceExponent);
+		const bool  bOddExponent      = bIntegerExponent && (FMath::RoundToInt(Settings.SlammingForceExponent) & 1) != 0;
+		const float NegativeBaseValue = !bIntegerExponent ? 1.f : (bOddExponent ? 0.f : -1.f); // -1 uses the pow of the absolute base
+
+		const VectorRegister4Float Exponent          = VectorSetFloat1(Settings.SlammingForceExponent);
+		const VectorRegister4Float InvMaxAcceleration = VectorSetFloat1(1.f / (Settings.MaxSlammingForceAtAcceleration * DeltaTime));
+		const VectorRegister4Float NegativeBase      = VectorSetFloat1(NegativeBaseValue);
+		const VectorRegister4Float bUseAbsPow        = VectorCompareLT(NegativeBase, VectorZeroFloat());
+		const VectorRegister4Float StoppingScale     = VectorSetFloat1(-BodyMass * 2.f / TotalBodyArea * 100.f /* N -> cN */);
+
+		alignas(16) float SweptAreaDelta[4];
+
+		FForceAccumulator4 Accumulator;
+		for (int32 i = FirstTriangle; i < EndTriangle; i += 4)
+		{
+			for (int32 j = 0; j < 4; ++j)
+			{
+				const int32 OriginalTriangleIndex = SoA.OriginalTriangleIndex[i + j];
+				SweptAreaDelta[j] = CurrentFrame[OriginalTriangleIndex].SweptWaterArea - PreviousFrame[OriginalTriangleIndex].SweptWaterArea;
+			}
+
+			// Triangles receding from the water get no stopping force
+			const VectorRegister4Float Dot       = SoA.Load(FTriangleDataSoA::VelocityNormalDot, i);
+			const VectorRegister4Float Area      = SoA.Load(FTriangleDataSoA::Area, i);
+			const VectorRegister4Float bSlamming = VectorCompareGT(Dot, VectorZeroFloat());
+
+			// FlowAcceleration / MaxSlammingForceAtAcceleration, where FlowAcceleration = SweptAreaDelta / (Area * DeltaTime)
+			const VectorRegister4Float Base     = VectorDivide(VectorMultiply(VectorLoadAligned(SweptAreaDelta), InvMaxAcceleration), VectorSelect(bSlamming, Area, VectorOneFloat()));
+			const VectorRegister4Float AbsPow   = VectorFastPow(VectorAbs(Base), Exponent);
+			const VectorRegister4Float Pow      = VectorSelect(VectorCompareLT(Base, VectorZeroFloat()), VectorSelect(bUseAbsPow, AbsPow, NegativeBase), AbsPow);
+			const VectorRegister4Float Amount   = VectorMin(VectorMax(Pow, VectorZeroFloat()), VectorOneFloat());
+			const VectorRegister4Float Scale    = VectorSelect(bSlamming, VectorMultiply(VectorMultiply(Amount, Dot), VectorMultiply(StoppingScale, Area)), VectorZeroFloat());
+
+			Accumulator.Add(SoA, i,
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::VelocityX, i)),
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::VelocityY, i)),
+				VectorMultiply(Scale, SoA.Load(FTriangleDataSoA::VelocityZ, i)));
+		}
+		return Accumulator.Reduce(BodyCenterOfMass);
+	}
+};
+
+using namespace WaterPhysics;
+
+void FWaterPhysicsScene::StepWaterPhysicsScene(float DeltaTime, const FVector& Gravity, const FWaterPhysicsSettings& SceneSettings, 
+	const FGetWaterInfoAtLocation& SurfaceGetter, bool bSurfaceGetterThreadSafe, FWaterSurfaceProvider* WaterSurfaceProvider, UObject* DebugContext)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(StepWaterPhysics);
+	SCOPED_OBJECT_DATA_CAPTURE(
+		FString::Printf(TEXT("%s.%s"), (DebugContext ? *DebugContext->GetOuter()->GetName() : TEXT("None")), (DebugContext ? *DebugContext->GetName() : TEXT("None"))),
+		TEXT("WaterPhysicsScene")
+	);
+
+	// Every frame allocation of the step, including those of its worker tasks, comes from this scene's arena
+	FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+
+	// Step 0: Gather up all the bodies we are about to process
+	FWaterBodyList BodiesToProcess;
+	RemoveInvalidComponents();
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SortBodiesByCost);
+
+		BodiesToProcess.SetNumUninitialized(Bodies.Num());
+		for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); ++BodyIndex)
+			BodiesToProcess[BodyIndex] = BodyIndex;
+
+		// Most expensive bodies first, so a large body is never picked up last while the other workers run out of work
+		BodiesToProcess.StableSort([this](int32 A, int32 B) 
+		{ 
+			return Bodies[A].GetScheduledStepCost() > Bodies[B].GetScheduledStepCost(); 
+		});
+	}
+
+	// Compared once per step so that direct edits of the scene settings, e.g. from blueprints, are picked up as well
+	if (!FWaterPhysicsSettings::StaticStruct()->CompareScriptStruct(&CachedSceneSettings, &SceneSettings, PPF_None))
+	{
+		CachedSceneSettings     = SceneSettings;
+		SceneSettingsGeneration = FMath::Max(SceneSettingsGeneration + 1, 1u);
+	}
+
+	if (WaterSurfaceProvider)
+		WaterSurfaceProvider->BeginStepScene();
+
+	const bool bExecuteInParallel = bSurfaceGetterThreadSafe && (WaterSurfaceProvider ? WaterSurfaceProvider->SupportsParallelExecution() : true);
+
+	if (bExecuteInParallel)
+		StepWaterBodies_Parallel(BodiesToProcess, DeltaTime,Gravity, SceneSettings, SurfaceGetter, WaterSurfaceProvider);
+	else
+		StepWaterBodies_Synchronous(BodiesToProcess, DeltaTime,Gravity, SceneSettings, SurfaceGetter, WaterSurfaceProvider);
+
+	if (WaterSurfaceProvider)
+		WaterSurfaceProvider->EndStepScene();
+
+	// Everything allocated from the frame arena is dead after this point
+	BodiesToProcess.Empty();
+	FrameArena.Reset();
+
+	SwapBuffers();
+}
+
+FWaterPhysicsScene::FWaterPhysicsScene()
+{
+	DestroyPhysicsStateHandle = UActorComponent::GlobalDestroyPhysicsDelegate.AddRaw(this, &FWaterPhysicsScene::OnComponentDestroyPhysicsState);
+	PostGarbageCollectHandle  = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FWaterPhysicsScene::OnPostGarbageCollect);
+}
+
+FWaterPhysicsScene::~FWaterPhysicsScene()
+{
+	UActorComponent::GlobalDestroyPhysicsDelegate.Remove(DestroyPhysicsStateHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+}
+
+void FWaterPhysicsScene::OnComponentDestroyPhysicsState(UActorComponent* Component)
+{
+	// Called for every component of the world, the physics state is also destroyed when the component is only being recreated
+	const FObjectKey ComponentKey(Component);
+	if (ComponentBodyHandles.Contains(ComponentKey))
+		PendingComponentChecks.AddUnique(ComponentKey);
+}
+
+void FWaterPhysicsScene::RemoveInvalidComponents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(RemoveInvalidComponents);
+
+	if (bSweepInvalidComponents)
+	{
+		// Backwards, removal swaps the last body into the gap
+		for (int32 BodyIndex = Bodies.Num() - 1; BodyIndex >= 0; --BodyIndex)
+		{
+			if (!IsValid(BodyComponents[BodyIndex]))
+				RemoveBodyAt(BodyIndex);
+		}
+
+		bSweepInvalidComponents = false;
+	}
+	else
+	{
+		for (const FObjectKey& ComponentKey : PendingComponentChecks)
+		{
+			const FComponentBodyHandles* Handles = ComponentBodyHandles.Find(ComponentKey);
+			if (Handles && !IsValid(BodyComponents[GetBodyIndex((*Handles)[0])]))
+				RemoveComponentBodies(ComponentKey);
+		}
+	}
+
+	PendingComponentChecks.Reset();
+}
+
+void FWaterPhysicsScene::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(BodyComponents);
+}
+
+FWaterPhysicsScene::FWaterPhysicsBodyHandle FWaterPhysicsScene::AddComponentBody(const UActorComponent* Component, const FName& BodyName, const FWaterPhysicsSettings& WaterPhysicsSettings)
+{
+	const FWaterPhysicsBodyHandle ExistingHandle = FindComponentBody(Component, BodyName);
+	if (ExistingHandle.IsValid())
+	{
+		SetBodyWaterPhysicsSettings(ExistingHandle, WaterPhysicsSettings);
+		BodyTriangleFrames[GetBodyIndex(ExistingHandle)].Empty();
+		return ExistingHandle;
+	}
+
+	FWaterPhysicsBodyHandle Handle;
+	Handle.Slot   = FreeBodySlots.Num() > 0 ? FreeBodySlots.Pop(EAllowShrinking::No) : BodySlots.AddDefaulted();
+	Handle.Serial = BodySlots[Handle.Slot].Serial;
+
+	const int32 BodyIndex = Bodies.AddDefaulted();
+	BodyComponents.Add(Component);
+	BodyNames.Add(BodyName);
+	BodyMergedSettings.AddDefaulted();
+	BodyActingForces.Add(FActingForces(ForceInit));
+	BodyTriangleFrames.AddDefaulted();
+	BodySettings.Add(WaterPhysicsSettings);
+	BodyHandles.Add(Handle);
+	BodyComponentKeys.Add(FObjectKey(Component));
+
+	BodySlots[Handle.Slot].BodyIndex = BodyIndex;
+	ComponentBodyHandles.FindOrAdd(FObjectKey(Component)).Add(Handle);
+
+	return Handle;
+}
+
+bool FWaterPhysicsScene::RemoveBody(const FWaterPhysicsBodyHandle& Handle)
+{
+	const int32 BodyIndex = GetBodyIndex(Handle);
+	if (BodyIndex == INDEX_NONE)
+		return false;
+
+	RemoveBodyAt(BodyIndex);
+	return true;
+}
+
+bool FWaterPhysicsScene::RemoveComponent(const UActorComponent* Component)
+{
+	return RemoveComponentBodies(FObjectKey(Component));
+}
+
+bool FWaterPhysicsScene::RemoveComponentBodies(const FObjectKey& ComponentKey)
+{
+	FComponentBodyHandles Handles;
+	if (!ComponentBodyHandles.RemoveAndCopyValue(ComponentKey, Handles))
+		return false;
+
+	for (const FWaterPhysicsBodyHandle& Handle : Handles)
+		RemoveBody(Handle);
+
+	return true;
+}
+
+void FWaterPhysicsScene::RemoveBodyAt(int32 BodyIndex)
+{
+	const FWaterPhysicsBodyHandle Handle = BodyHandles[BodyIndex];
+
+	if (FComponentBodyHandles* Handles = ComponentBodyHandles.Find(BodyComponentKeys[BodyIndex]))
+	{
+		Handles->RemoveSingleSwap(Handle, EAllowShrinking::No);
+		if (Handles->Num() == 0)
+			ComponentBodyHandles.Remove(BodyComponentKeys[BodyIndex]);
+	}
+
+	// Free the slot, bumping the serial invalidates every handle still pointing at it
+	FBodySlot& Slot = BodySlots[Handle.Slot];
+	Slot.BodyIndex = INDEX_NONE;
+	Slot.Serial++;
+	FreeBodySlots.Add(Handle.Slot);
+
+	Bodies.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyComponents.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyNames.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyMergedSettings.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyActingForces.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyTriangleFrames.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodySettings.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyHandles.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+	BodyComponentKeys.RemoveAtSwap(BodyIndex, 1, EAllowShrinking::No);
+
+	// The last body now lives in the gap
+	if (BodyIndex < Bodies.Num())
+		BodySlots[BodyHandles[BodyIndex].Slot].BodyIndex = BodyIndex;
+}
+
+void FWaterPhysicsScene::ClearWaterPhysicsScene()
+{
+	Bodies.Reset();
+	BodyComponents.Reset();
+	BodyNames.Reset();
+	BodyMergedSettings.Reset();
+	BodyActingForces.Reset();
+	BodyTriangleFrames.Reset();
+	BodySettings.Reset();
+	BodyHandles.Reset();
+	BodyComponentKeys.Reset();
+	ComponentBodyHandles.Reset();
+	PendingComponentChecks.Reset();
+
+	// Slots are kept so that handles from before the clear never resolve to new bodies
+	FreeBodySlots.Reset();
+	for (int32 SlotIndex = 0; SlotIndex < BodySlots.Num(); ++SlotIndex)
+	{
+		if (BodySlots[SlotIndex].BodyIndex != INDEX_NONE)
+		{
+			BodySlots[SlotIndex].BodyIndex = INDEX_NONE;
+			BodySlots[SlotIndex].Serial++;
+		}
+		FreeBodySlots.Add(SlotIndex);
+	}
+
+	FScopeLock Lock(&SharedTriangulationsCS);
+	SharedTriangulations.Reset();
+}
+
+template<typename FVec>
+FWaterPhysicsScene::FFrameInfo FWaterPhysicsScene::InitFrame(FPersistentTriangleFrames& TriangleFrames, const FBodyLocalMesh& LocalMesh, 
+	const TSubmergedTriangleArray<FVec>& SubmergedTriangles, const FVector& BodyCenterOfMass, const FVector& BodyLinearVelocity, const FVector& BodyAngularVelocity, 
+	bool bTriangleData, bool bTriangleDataSoA, int32 ParallelTriangleThreshold)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(InitBodyFrame);
+
+	const FVec CenterOfMass(BodyCenterOfMass);
+	const FVec LinearVelocity(BodyLinearVelocity);
+	const FVec AngularVelocity(BodyAngularVelocity);
+
+	FFrameInfo FrameInfo(
+		TriangleFrames.Frames[GetFrameIndex(Frame_Current)], 
+		TriangleFrames.Frames[GetFrameIndex(Frame_Previous)]
+	);
+
+	const int32 NumTriangles = SubmergedTriangles.TriangleList.Num();
+
+	FrameInfo.CurrentFrame.SetNumUninitialized(LocalMesh.IndexList.Num() / 3);
+	FMemory::Memzero(FrameInfo.CurrentFrame.GetData(), sizeof(FrameInfo.CurrentFrame[0]) * FrameInfo.CurrentFrame.Num());
+
+	if (bTriangleData)
+		FrameInfo.TriangleData.SetNumUninitialized(NumTriangles);
+
+	// Padding triangles are left zeroed, they have no area and add nothing to the sums
+	float* SoAFields[FTriangleDataSoA::NumFields] = {};
+	if (bTriangleDataSoA)
+	{
+		FTriangleDataSoA& SoA = FrameInfo.TriangleDataSoA;
+		SoA.Num = Align(NumTriangles, 4);
+		SoA.Fields.SetNumZeroed(SoA.Num * FTriangleDataSoA::NumFields);
+		SoA.OriginalTriangleIndex.SetNumZeroed(SoA.Num);
+
+		for (int32 Field = 0; Field < FTriangleDataSoA::NumFields; ++Field)
+			SoAFields[Field] = SoA.GetField((FTriangleDataSoA::EField)Field);
+	}
+
+	struct FRangeSums
+	{
+		FVector FluidVelocity = FVector::ZeroVector;
+		float   SubmergedArea = 0.f;
+	};
+
+	TFrameArray<float> SweptWaterAreas;
+	SweptWaterAreas.SetNumUninitialized(NumTriangles);
+
+	const auto SetupRange = [&](int32 FirstTriangle, int32 EndTriangle, FRangeSums& Sums)
+	{
+		for (int32 i = FirstTriangle; i < EndTriangle; ++i)
+		{
+			const auto& SubmergedTriangle = SubmergedTriangles.TriangleList[i];
+
+			const FVec Vertices[3] = { 
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].Position,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].Position,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].Position
+			};
+			const FVec WaterVelocities[3] = { 
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].WaterVelocity * 0.01f /* cm/s -> m/s */,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].WaterVelocity * 0.01f /* cm/s -> m/s */,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].WaterVelocity * 0.01f /* cm/s -> m/s */
+			};
+			const float Depths[3] = { 
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].Depth * 0.01f /* cm -> m */,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].Depth * 0.01f /* cm -> m */,
+				SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].Depth * 0.01f /* cm -> m */
+			};
+
+			const FVec OriginalTriangleVertices[3] = { 
+				GetLocalVertex<FVec>(LocalMesh, LocalMesh.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 0]),
+				GetLocalVertex<FVec>(LocalMesh, LocalMesh.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 1]),
+				GetLocalVertex<FVec>(LocalMesh, LocalMesh.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 2]),
+			};
+
+			const FVec  Centroid            = CalcTriangleElemAvg(Vertices);
+			const FVec  Normal              = FVec::CrossProduct(OriginalTriangleVertices[1] - OriginalTriangleVertices[0], OriginalTriangleVertices[2] - OriginalTriangleVertices[0]).GetSafeNormal(); // Submerged triangle might be too small for accurate calculation, use OriginalTriangleVertices
+			const FVec  Velocity            = (LinearVelocity + FVec::CrossProduct(AngularVelocity, Centroid - CenterOfMass)) * 0.01f /* cm/s -> m/s */ - CalcTriangleElemAvg(WaterVelocities);
+			const float VelocitySizeSquared = Velocity.SizeSquared();
+			const float VelocityInvSqrtSize = VelocitySizeSquared > SMALL_NUMBER ? FMath::InvSqrt(VelocitySizeSquared) : 0.f;
+			const float Area                = FMath::Max(CalcTriangleAreaM2(Vertices), 0.001f);
+			const float AvgDepth            = CalcTriangleElemAvg(Depths);
+			const float VelocitySize        = VelocitySizeSquared * VelocityInvSqrtSize;
+			const float VelocityNormalDot   = FVec::DotProduct(Velocity * VelocityInvSqrtSize, Normal);
+
+			if (bTriangleData)
+			{
+				auto& TriangleData = FrameInfo.TriangleData[i];
+				TriangleData.Centroid              = FVector(Centroid);
+				TriangleData.Normal                = FVector(Normal);
+				TriangleData.Area                  = Area;
+				TriangleData.AvgDepth              = AvgDepth;
+				TriangleData.Velocity              = FVector(Velocity);
+				TriangleData.VelocitySizeSquared   = VelocitySizeSquared;
+				TriangleData.VelocitySize          = VelocitySize;
+				TriangleData.VelocityNormal        = FVector(Velocity * VelocityInvSqrtSize);
+				TriangleData.VelocityNormalDot     = VelocityNormalDot;
+				TriangleData.OriginalTriangleIndex = SubmergedTriangle.OriginalTriangleIndex;
+			}
+
+			if (bTriangleDataSoA)
+			{
+				const FVec RelativeCentroid = Centroid - CenterOfMass;
+				SoAFields[FTriangleDataSoA::CentroidX][i]         = (float)RelativeCentroid.X;
+				SoAFields[FTriangleDataSoA::CentroidY][i]         = (float)RelativeCentroid.Y;
+				SoAFields[FTriangleDataSoA::CentroidZ][i]         = (float)RelativeCentroid.Z;
+				SoAFields[FTriangleDataSoA::NormalX][i]           = (float)Normal.X;
+				SoAFields[FTriangleDataSoA::NormalY][i]           = (float)Normal.Y;
+				SoAFields[FTriangleDataSoA::NormalZ][i]           = (float)Normal.Z;
+				SoAFields[FTriangleDataSoA::VelocityX][i]         = (float)Velocity.X;
+				SoAFields[FTriangleDataSoA::VelocityY][i]         = (float)Velocity.Y;
+				SoAFields[FTriangleDataSoA::VelocityZ][i]         = (float)Velocity.Z;
+				SoAFields[FTriangleDataSoA::Area][i]              = Area;
+				SoAFields[FTriangleDataSoA::AvgDepth][i]          = AvgDepth;
+				SoAFields[FTriangleDataSoA::VelocitySize][i]      = VelocitySize;
+				SoAFields[FTriangleDataSoA::VelocityNormalDot][i] = VelocityNormalDot;
+
+				FrameInfo.TriangleDataSoA.OriginalTriangleIndex[i] = SubmergedTriangle.OriginalTriangleIndex;
+			}
+
+			// Tessellated pieces of one mesh triangle can end up in different ranges, they are summed up per mesh triangle below
+			SweptWaterAreas[i] = VelocityNormalDot > 0.f ? Area * VelocitySize : 0.f;
+
+			Sums.FluidVelocity -= FVector(Velocity);
+			Sums.SubmergedArea += Area;
+		}
+	};
+
+	// The partial sums are reduced in range order, so the result does not depend on which task finishes first
+	const int32 NumRanges = GetNumTriangleRanges(NumTriangles, ParallelTriangleThreshold);
+
+	TInlineFrameArray<FRangeSums, 16> PartialSums;
+	PartialSums.SetNum(NumRanges);
+	ForEachTriangleRange(NumTriangles, NumRanges, [&](int32 RangeIndex, int32 FirstTriangle, int32 EndTriangle)
+	{
+		SetupRange(FirstTriangle, EndTriangle, PartialSums[RangeIndex]);
+	});
+
+	for (const FRangeSums& Sums : PartialSums)
+	{
+		FrameInfo.AvgFluidVelocity   += Sums.FluidVelocity;
+		FrameInfo.TotalSubmergedArea += Sums.SubmergedArea;
+	}
+
+	// Only read by the slamming force, cheap enough to always keep up to date so the previous frame is valid when it gets enabled
+	for (int32 i = 0; i < NumTriangles; ++i)
+		FrameInfo.CurrentFrame[SubmergedTriangles.TriangleList[i].OriginalTriangleIndex].SweptWaterArea += SweptWaterAreas[i];
+
+	if (FrameInfo.PreviousFrame.Num() != FrameInfo.CurrentFrame.Num())
+	{
+		FrameInfo.PreviousFrame.SetNumUninitialized(FrameInfo.CurrentFrame.Num());
+		FMemory::Memcpy(FrameInfo.PreviousFrame.GetData(), FrameInfo.CurrentFrame.GetData(), sizeof(FrameInfo.CurrentFrame[0]) * FrameInfo.CurrentFrame.Num());
+	}
+
+	EXEC_WITH_WATER_PHYS_DEBUG(
+	{
+		for (const auto& TriangleData : FrameInfo.TriangleData) {
+			FrameInfo.bSuccess &= TriangleData.IsValid();
+		}
+		for (const float Value : FrameInfo.TriangleDataSoA.Fields) {
+			FrameInfo.bSuccess &= !FMath::IsNaN(Value);
+		}
+	});
+
+	return FrameInfo;
+}
+
+FWaterPhysicsScene::FWaterBodyProcessingResult FWaterPhysicsScene::ProcessWaterPhysicsBody(const UActorComponent* Component, int32 BodyIndex, 
+	const FWaterPhysicsSettings& SceneSettings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ProcessWaterPhysicsBody);
+
+	FWaterPhysicsBody& WaterBody = Bodies[BodyIndex];
+	const FName&       BodyName  = BodyNames[BodyIndex];
+
+	FWaterBodyProcessingResult Result;
+
+	// Destroyed components without physics state are only removed after the next GC, see RemoveInvalidComponents
+	if (!IsValid(Component))
+	{
+		Result.BodyInstance = nullptr;
+		return Result;
+	}
+
+	const UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component);
+	Result.bHasWaterPhysicsCollisionInterface     = Component->Implements<UWaterPhysicsCollisionInterface>();
+
+	checkf(
+		Result.bHasWaterPhysicsCollisionInterface || PrimitiveComponent != nullptr, 
+		TEXT("Tried to step water physics scene with component %s which does not implement WaterPhysicsCollisionInterface and is not a PrimitiveComponent."),
+		*Component->GetName()
+	);
+
+	Result.BodyInstance = Result.bHasWaterPhysicsCollisionInterface
+		? dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component)->GetWaterPhysicsCollisionBodyInstance(BodyName, false)
+		: PrimitiveComponent->GetBodyInstance(BodyName, false);
+
+	const bool bIsWelded = Result.BodyInstance && Result.BodyInstance->WeldParent != nullptr;
+
+	if (!Result.BodyInstance 
+		|| (bIsWelded && !Result.BodyInstance->WeldParent->IsInstanceSimulatingPhysics())
+		|| (!bIsWelded && !Result.BodyInstance->IsInstanceSimulatingPhysics()))
+	{
+		BodyTriangleFrames[BodyIndex].Empty(); // Clear triangle data in case some body has disabled physics/collison/been destroyed
+		Result.BodyInstance = nullptr;
+		return Result;
+	}
+
+	// Only merge when the settings of the body or the scene have changed since last time
+	if (WaterBody.MergedSettingsGeneration != SceneSettingsGeneration)
+	{
+		BodyMergedSettings[BodyIndex]      = FWaterPhysicsSettings::MergeWaterPhysicsSettings(SceneSettings, BodySettings[BodyIndex]);
+		WaterBody.MergedSettingsGeneration = SceneSettingsGeneration;
+	}
+
+	Result.WaterPhysicsSettings = &BodyMergedSettings[BodyIndex];
+
+	return Result;
+}
+
+void FWaterPhysicsScene::ReadBodyStates(TArrayView<FWaterBodyProcessingResult> BodyProcessingResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ReadBodyStates);
+
+	// All bodies of a world normally live in the same physics scene, but nothing stops a component from being simulated elsewhere
+	TArray<FPhysScene*, TInlineAllocator<4>> PhysicsScenes;
+	for (const FWaterBodyProcessingResult& Result : BodyProcessingResults)
+	{
+		if (Result.BodyInstance)
+			PhysicsScenes.AddUnique(Result.GetRootBodyInstance()->GetPhysicsScene());
+	}
+
+	for (FPhysScene* PhysicsScene : PhysicsScenes)
+	{
+		const auto ForEachBodyInScene = [&](TFunctionRef<void(FWaterBodyProcessingResult&, FBodyInstance*)> Callable)
+		{
+			for (FWaterBodyProcessingResult& Result : BodyProcessingResults)
+			{
+				if (Result.BodyInstance && Result.GetRootBodyInstance()->GetPhysicsScene() == PhysicsScene)
+					Callable(Result, Result.GetRootBodyInstance());
+			}
+		};
+
+		const bool bRead = PhysicsScene && FPhysicsCommand::ExecuteRead(PhysicsScene, [&]()
+		{
+			ForEachBodyInScene([](FWaterBodyProcessingResult& Result, FBodyInstance* BodyInstance)
+			{
+				const FPhysicsActorHandle& ActorHandle = BodyInstance->GetPhysicsActorHandle();
+				if (!FPhysicsInterface::IsValid(ActorHandle))
+				{
+					Result.BodyInstance = nullptr;
+					return;
+				}
+
+				FBodyState& State     = Result.BodyState;
+				State.LinearVelocity  = FPhysicsInterface::GetLinearVelocity_AssumesLocked(ActorHandle);
+				State.AngularVelocity = FPhysicsInterface::GetAngularVelocity_AssumesLocked(ActorHandle);
+				State.CenterOfMass    = FPhysicsInterface::GetComTransform_AssumesLocked(ActorHandle).GetLocation();
+				State.Mass            = FPhysicsInterface::GetMass_AssumesLocked(ActorHandle);
+				State.InertiaTensor   = FPhysicsInterface::GetLocalInertiaTensor_AssumesLocked(ActorHandle);
+				State.Transform       = BodyInstance->GetUnrealWorldTransform_AssumesLocked();
+			});
+		});
 
-		for (auto It = WaterPhysicsBodies.CreateIterator(); It; ++It)
-		{
-			if (!IsValid(It.Key()))
-				It.RemoveCurrent();
-		}
+		if (!bRead)
+			ForEachBodyInScene([](FWaterBodyProcessingResult& Result, FBodyInstance*) { Result.BodyInstance = nullptr; });
 	}
+}
 
+FWaterPhysicsScene::FSharedBodyLocalMesh FWaterPhysicsScene::FindOrAddSharedTriangulation(const FSharedTriangulationKey& Key, 
+	TFunctionRef<FSharedBodyLocalMesh()> BuildLocalMesh)
+{
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(CountBodies);
-
-		for (auto& ComponentWaterPhysicsBodies : WaterPhysicsBodies)
+		FScopeLock Lock(&SharedTriangulationsCS);
+		if (const TWeakPtr<const FBodyLocalMesh, ESPMode::ThreadSafe>* ExistingMesh = SharedTriangulations.Find(Key))
 		{
-			for (FWaterPhysicsBody& WaterPhysicsBody : ComponentWaterPhysicsBodies.Value)
-				BodiesToProcess.Emplace(ComponentWaterPhysicsBodies.Key, &WaterPhysicsBody);
+			if (FSharedBodyLocalMesh Mesh = ExistingMesh->Pin())
+				return Mesh;
 		}
 	}
 
-	if (WaterSurfaceProvider)
-		WaterSurfaceProvider->BeginStepScene();
+	// Triangulate outside of the lock so that bodies with different collision can be triangulated in parallel
+	FSharedBodyLocalMesh NewMesh = BuildLocalMesh();
 
-	const bool bExecuteInParallel = bSurfaceGetterThreadSafe && (WaterSurfaceProvider ? WaterSurfaceProvider->SupportsParallelExecution() : true);
+	FScopeLock Lock(&SharedTriangulationsCS);
 
-	if (bExecuteInParallel)
-		StepWaterBodies_Parallel(BodiesToProcess, DeltaTime,Gravity, SceneSettings, SurfaceGetter, WaterSurfaceProvider);
-	else
-		StepWaterBodies_Synchronous(BodiesToProcess, DeltaTime,Gravity, SceneSettings, SurfaceGetter, WaterSurfaceProvider);
+	// Another body might have triangulated the same collision while we were not holding the lock
+	TWeakPtr<const FBodyLocalMesh, ESPMode::ThreadSafe>& SharedMesh = SharedTriangulations.FindOrAdd(Key);
+	if (FSharedBodyLocalMesh Mesh = SharedMesh.Pin())
+		return Mesh;
 
-	if (WaterSurfaceProvider)
-		WaterSurfaceProvider->EndStepScene();
+	SharedMesh = NewMesh;
 
-	SwapBuffers();
-}
+	// Forget triangulations which are no longer used by any body
+	for (auto It = SharedTriangulations.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().IsValid())
+			It.RemoveCurrent();
+	}
 
-void FWaterPhysicsScene::AddReferencedObjects(FReferenceCollector& Collector)
-{
-	Collector.AddReferencedObjects(WaterPhysicsBodies);
+	return NewMesh;
 }
 
-FWaterPhysicsScene::FFrameInfo FWaterPhysicsScene::InitFrame(FWaterPhysicsBody& WaterPhysicsBody, const FIndexedTriangleMesh& TriangulatedBody, 
-	const FSubmergedTriangleArray& SubmergedTriangles, const FVector& BodyCenterOfMass, const FVector& BodyLinearVelocity, const FVector& BodyAngularVelocity)
+FWaterPhysicsScene::FBodyTriangulationResult FWaterPhysicsScene::TriangulateBody(const UActorComponent* Component, int32 BodyIndex, 
+	const FWaterBodyProcessingResult& BodyProcessingResult)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(InitBodyFrame);
+	TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateBody);
 
-	FFrameInfo FrameInfo(
-		WaterPhysicsBody.PersistentTriangleData[GetFrameIndex(Frame_Current)], 
-		WaterPhysicsBody.PersistentTriangleData[GetFrameIndex(Frame_Previous)]
-	);
+	FWaterPhysicsBody& WaterBody = Bodies[BodyIndex];
+	const FName&       BodyName  = BodyNames[BodyIndex];
 
-	FrameInfo.TriangleData.SetNumUninitialized(SubmergedTriangles.TriangleList.Num());
-	FrameInfo.CurrentFrame.SetNumUninitialized(TriangulatedBody.IndexList.Num() / 3);
-	FMemory::Memzero(FrameInfo.CurrentFrame.GetData(), sizeof(FrameInfo.CurrentFrame[0]) * FrameInfo.CurrentFrame.Num());
+	FBodyTriangulationResult Result;
 
-	for (int32 i = 0; i < SubmergedTriangles.TriangleList.Num(); ++i)
-	{
-		auto& TriangleData = FrameInfo.TriangleData[i];
-		const auto& SubmergedTriangle = SubmergedTriangles.TriangleList[i];
+	Result.BodyProcessingResult = &BodyProcessingResult;
 
-		const FVector Vertices[3] = { 
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].Position,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].Position,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].Position
-		};
-		const FVector WaterVelocities[3] = { 
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].WaterVelocity * 0.01f /* cm/s -> m/s */,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].WaterVelocity * 0.01f /* cm/s -> m/s */,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].WaterVelocity * 0.01f /* cm/s -> m/s */
-		};
-		const float Depths[3] = { 
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[0]].Depth * 0.01f /* cm -> m */,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[1]].Depth * 0.01f /* cm -> m */,
-			SubmergedTriangles.VertexList[SubmergedTriangle.Indices[2]].Depth * 0.01f /* cm -> m */
-		};
+	if (BodyProcessingResult.BodyInstance == nullptr)
+		return Result;
 
-		const FVector OriginalTriangleVertices[3] = { 
-			TriangulatedBody.VertexList[TriangulatedBody.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 0]],
-			TriangulatedBody.VertexList[TriangulatedBody.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 1]],
-			TriangulatedBody.VertexList[TriangulatedBody.IndexList[SubmergedTriangle.OriginalTriangleIndex * 3 + 2]],
-		};
+	FBodyInstance* BodyInstance = BodyProcessingResult.BodyInstance;
 
-		TriangleData.Centroid              = CalcTriangleCentroid(Vertices);
-		TriangleData.Normal                = CalcTriangleNormal(OriginalTriangleVertices); // Submerged triangle might be too small for accurate calculation, use OriginalTriangleVertices
-		TriangleData.Area                  = FMath::Max(CalcTriangleAreaM2(Vertices), 0.001f);
-		TriangleData.AvgDepth              = CalcTriangleElemAvg(Depths);
-		TriangleData.Velocity              = CalcVertexVelocityMS(TriangleData.Centroid, BodyCenterOfMass, BodyLinearVelocity, BodyAngularVelocity) - CalcTriangleElemAvg(WaterVelocities);
-		TriangleData.VelocitySizeSquared   = TriangleData.Velocity.SizeSquared();
-		const float VelocityInvSqrtSize    = TriangleData.VelocitySizeSquared > SMALL_NUMBER ? FMath::InvSqrt(TriangleData.VelocitySizeSquared) : 0.f;
-		TriangleData.VelocitySize          = TriangleData.VelocitySizeSquared * VelocityInvSqrtSize;
-		TriangleData.VelocityNormal        = TriangleData.Velocity * VelocityInvSqrtSize;
-		TriangleData.VelocityNormalDot     = FVector::DotProduct(TriangleData.VelocityNormal, TriangleData.Normal);
-		TriangleData.OriginalTriangleIndex = SubmergedTriangle.OriginalTriangleIndex;
+	// Resolve the body-space to world-space transform along with the key describing the current collision of the body
+	FTransform             BodyTransform(NoInit);
+	FTriangulationCacheKey CacheKey;
+	CacheKey.SubdivisionSettings = BodyProcessingResult.WaterPhysicsSettings->SubdivisionSettings;
 
-		FrameInfo.AvgFluidVelocity -= TriangleData.Velocity;
-		FrameInfo.TotalSubmergedArea += TriangleData.Area;
-	}
+	const IWaterPhysicsCollisionInterface* CollisionInterface = BodyProcessingResult.bHasWaterPhysicsCollisionInterface 
+		? dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component) 
+		: nullptr;
 
-	if (FrameInfo.PreviousFrame.Num() != FrameInfo.CurrentFrame.Num())
+	if (CollisionInterface)
 	{
-		FrameInfo.PreviousFrame.SetNumUninitialized(FrameInfo.CurrentFrame.Num());
-		FMemory::Memcpy(FrameInfo.PreviousFrame.GetData(), FrameInfo.CurrentFrame.GetData(), sizeof(FrameInfo.CurrentFrame[0]) * FrameInfo.CurrentFrame.Num());
+		const FTransform CollisionTransform = CollisionInterface->GetWaterPhysicsCollisionWorldTransform(BodyName);
+		BodyTransform = FTransform(CollisionTransform.GetRotation(), CollisionTransform.GetTranslation());
+
+		CacheKey.CollisionSource = Component;
+		CacheKey.Scale3D         = CollisionTransform.GetScale3D();
+		CacheKey.CollisionHash   = CollisionInterface->GetWaterPhysicsCollisionSetupHash(BodyName);
+	}
+	else
+	{
+		FBodyInstance* ParentBodyInstance = BodyProcessingResult.GetRootBodyInstance();
+		BodyTransform = BodyProcessingResult.BodyState.Transform;
+
+		CacheKey.CollisionSource = BodyInstance->GetBodySetup();
+		CacheKey.WeldParent      = BodyInstance->WeldParent;
+		CacheKey.Scale3D         = BodyInstance->Scale3D;
+		CacheKey.WeldRelativeTM  = GetWeldRelativeTransform(BodyInstance);
+		CacheKey.ParentScale3D   = ParentBodyInstance->Scale3D;
+		CacheKey.CollisionHash   = HashBodySetupCollision(BodyInstance->GetBodySetup());
 	}
 
-	EXEC_WITH_WATER_PHYS_DEBUG(
+	const bool bAnalytic = BodyProcessingResult.WaterPhysicsSettings->EvaluationMode == EWaterPhysicsEvaluationMode::Analytic;
+
+	// Re-triangulate the body if the collision has changed since last step
+	FTriangulationCache& Cache = WaterBody.TriangulationCache;
+	if (CacheKey.CollisionHash == 0 || !Cache.IsValid(CacheKey))
 	{
-		for (const auto& TriangleData : FrameInfo.TriangleData) {
-			FrameInfo.bSuccess &= TriangleData.IsValid();
-		}
-	});
+		TRACE_CPUPROFILER_EVENT_SCOPE(RebuildTriangulationCache);
 
-	return FrameInfo;
-}
+		// Only generated when the triangulation is not already shared by another body
+		const auto BuildLocalMesh = [&]()
+		{
+			const FWaterPhysicsCollisionSetup CollisionSetup = CollisionInterface
+				? GenerateLocalWaterPhysicsCollisionSetup(CollisionInterface, BodyName, CacheKey.Scale3D)
+				: GenerateBodyInstanceLocalWaterPhysicsCollisionSetup(BodyInstance, false);
 
-FWaterPhysicsScene::FWaterBodyProcessingResult FWaterPhysicsScene::ProcessWaterPhysicsBody(const UActorComponent* Component, FWaterPhysicsBody& WaterBody, const FWaterPhysicsSettings& SceneSettings)
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(ProcessWaterPhysicsBody);
+			TSharedPtr<const FWaterPhysicsCollisionSetup, ESPMode::ThreadSafe> PrimitiveCollisionSetup;
+			if (CollisionSetup.MeshElems.Num() == 0 && CollisionSetup.NumCollisionElems() > 0)
+				PrimitiveCollisionSetup = MakeShared<const FWaterPhysicsCollisionSetup, ESPMode::ThreadSafe>(CollisionSetup);
 
-	FWaterBodyProcessingResult Result;
+			FIndexedTriangleMesh         Mesh;
+			const TConstArrayView<int32> TemplateIndexList = TriangulateSinglePrimitiveElem(CollisionSetup, CacheKey.SubdivisionSettings, Mesh.VertexList);
+			if (TemplateIndexList.Num() == 0)
+			{
+				const FString DebugName = FString::Printf(TEXT("%s.%s"), *GetNameSafe(Component), *BodyName.ToString());
+				Mesh = TriangulateWaterPhysicsCollisionSetup(CollisionSetup, CacheKey.SubdivisionSettings, *DebugName);
+			}
 
-	const UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component);
-	Result.bHasWaterPhysicsCollisionInterface     = Component->Implements<UWaterPhysicsCollisionInterface>();
+			return MakeBodyLocalMesh(MoveTemp(Mesh), TemplateIndexList, MoveTemp(PrimitiveCollisionSetup));
+		};
 
-	checkf(
-		Result.bHasWaterPhysicsCollisionInterface || PrimitiveComponent != nullptr, 
-		TEXT("Tried to step water physics scene with component %s which does not implement WaterPhysicsCollisionInterface and is not a PrimitiveComponent."),
-		*Component->GetName()
-	);
+		Cache.Key = CacheKey;
+		WaterBody.bAnalyticFallback = false;
 
-	Result.BodyInstance = Result.bHasWaterPhysicsCollisionInterface
-		? dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component)->GetWaterPhysicsCollisionBodyInstance(WaterBody.BodyName, false)
-		: PrimitiveComponent->GetBodyInstance(WaterBody.BodyName, false);
+		// Un-welded bodies are fully described by their BodySetup and scale, which allows identical bodies to share the same triangulation.
+		// Welded bodies are triangulated in the space of their weld parent, so their triangulation is unique to them.
+		if (!CollisionInterface && !BodyInstance->WeldParent && CacheKey.CollisionHash != 0)
+		{
+			const FSharedTriangulationKey SharedKey = { BodyInstance->GetBodySetup(), CacheKey.CollisionHash, CacheKey.Scale3D, CacheKey.SubdivisionSettings };
+			Cache.LocalMesh = FindOrAddSharedTriangulation(SharedKey, BuildLocalMesh);
+		}
+		else
+		{
+			Cache.LocalMesh = BuildLocalMesh();
+		}
 
-	const bool bIsWelded = Result.BodyInstance && Result.BodyInstance->WeldParent != nullptr;
+		// Bodies without a collision hash are rebuilt every step, the rebuild is then part of what their measured cost has to cover.
+		// Analytic bodies only sample the water at their five bound points.
+		if (CacheKey.CollisionHash != 0)
+		{
+			if (bAnalytic && Cache.LocalMesh->PrimitiveCollisionSetup.IsValid())
+				WaterBody.SeedStepCost(0, 5);
+			else
+				WaterBody.SeedStepCost(Cache.LocalMesh->IndexList.Num() / 3, Cache.LocalMesh->VertexList.Num());
+		}
+	}
 
-	if (!Result.BodyInstance 
-		|| (bIsWelded && !Result.BodyInstance->WeldParent->IsInstanceSimulatingPhysics())
-		|| (!bIsWelded && !Result.BodyInstance->IsInstanceSimulatingPhysics()))
+	Result.BodyTransform = BodyTransform;
+
+	// Analytic bodies only need the water surface around them, so only provide the points to sample the water at
+	if (bAnalytic && Cache.LocalMesh->PrimitiveCollisionSetup.IsValid() && !WaterBody.bAnalyticFallback)
 	{
-		WaterBody.ClearTriangleData(); // Clear triangle data in case some body has disabled physics/collison/been destroyed
-		Result.BodyInstance = nullptr;
+		const FSphere LocalBounds = CalcPrimitiveCollisionBounds(*Cache.LocalMesh->PrimitiveCollisionSetup);
+		const FVector Center      = BodyTransform.TransformPosition(LocalBounds.Center);
+
+		Result.AnalyticCollisionSetup = Cache.LocalMesh->PrimitiveCollisionSetup;
+		Result.AnalyticSamplePoints   = {
+			Center,
+			Center + FVector::ForwardVector * LocalBounds.W,
+			Center - FVector::ForwardVector * LocalBounds.W,
+			Center + FVector::RightVector * LocalBounds.W,
+			Center - FVector::RightVector * LocalBounds.W
+		};
+
 		return Result;
 	}
 
-	Result.WaterPhysicsSettings = FWaterPhysicsSettings::MergeWaterPhysicsSettings(SceneSettings, WaterBody.WaterPhysicsSettings);
+	// The rest of the step works on the cached mesh in body space
+	Result.LocalMesh = Cache.LocalMesh;
 
 	return Result;
 }
 
-FWaterPhysicsScene::FBodyTriangulationResult FWaterPhysicsScene::TriangulateBody(const UActorComponent* Component, const FWaterPhysicsBody& WaterBody, 
-	const FWaterBodyProcessingResult& BodyProcessingResult)
+// Compares the bounding sphere of the body against the water around it, against the center sample's plane for PerObject and the
+// surface height bounds otherwise. PerVertex fetching can't be bounded cheaply.
+FWaterPhysicsScene::EBodyWaterState FWaterPhysicsScene::ClassifyBodyWaterState(const UActorComponent* Component, const FBodyTriangulationResult& BodyTriangulationResult,
+	EWaterInfoFetchingMethod WaterInfoFetchingMethod, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider, FGetWaterInfoResult& OutBodyWaterInfo)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(TriangulateBody);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ClassifyBodyWaterState);
 
-	FBodyTriangulationResult Result;
+	const FSphere& LocalBounds = BodyTriangulationResult.LocalMesh->Bounds;
+	const FVector  Center      = BodyTriangulationResult.BodyTransform.TransformPosition(LocalBounds.Center);
 
-	Result.BodyProcessingResult = &BodyProcessingResult;
+	if (WaterInfoFetchingMethod == EWaterInfoFetchingMethod::PerObject)
+	{
+		OutBodyWaterInfo = FetchVerticesWaterInfo(Component, { Center }, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider)[0];
 
-	if (BodyProcessingResult.BodyInstance == nullptr)
-		return Result;
+		const FVector SurfaceNormal = OutBodyWaterInfo.WaterSurfaceNormal.GetSafeNormal();
+		const double  CenterDepth   = FVector::DotProduct(OutBodyWaterInfo.WaterSurfaceLocation - Center, SurfaceNormal);
 
-	const FWaterPhysicsCollisionSetup CollisionSetup = BodyProcessingResult.bHasWaterPhysicsCollisionInterface 
-		? GenerateWaterPhysicsCollisionSetup(dynamic_cast<const IWaterPhysicsCollisionInterface*>(Component), WaterBody.BodyName)
-		: GenerateBodyInstanceWaterPhysicsCollisionSetup(BodyProcessingResult.BodyInstance, false);
+		if (CenterDepth + LocalBounds.W < 0.0)
+			return EBodyWaterState::Dry;
 
-	Result.TriangulatedBody = TriangulateWaterPhysicsCollisionSetup(CollisionSetup, BodyProcessingResult.WaterPhysicsSettings.SubdivisionSettings);
+		if (CenterDepth - LocalBounds.W > 0.0)
+			return EBodyWaterState::Submerged;
 
-	return Result;
+		return EBodyWaterState::Partial;
+	}
+
+	FFloatInterval HeightBounds;
+	if (!WaterSurfaceProvider || !WaterSurfaceProvider->GetWaterHeightBounds(FBox::BuildAABB(Center, FVector(LocalBounds.W)), Component, SurfaceGetter, HeightBounds))
+		return EBodyWaterState::Partial;
+
+	if (Center.Z - LocalBounds.W > HeightBounds.Max)
+		return EBodyWaterState::Dry;
+
+	if (Center.Z + LocalBounds.W < HeightBounds.Min)
+	{
+		OutBodyWaterInfo = FetchVerticesWaterInfo(Component, { Center }, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider)[0];
+		return EBodyWaterState::Submerged;
+	}
+
+	return EBodyWaterState::Partial;
 }
 
 FWaterPhysicsScene::FFetchWaterSurfaceInfoResult FWaterPhysicsScene::FetchWaterSurfaceInfo(const UActorComponent* Component, const FWaterPhysicsBody& WaterBody, 
-	const FBodyTriangulationResult& BodyTriangulationResult, EWaterInfoFetchingMethod WaterInfoFetchingMethod, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
+	const FBodyTriangulationResult& BodyTriangulationResult, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FetchWaterSurfaceInfo);
 
+	// Taken from the body's own processing result, the step arrays are not indexed the same once bodies have been skipped
+	const EWaterInfoFetchingMethod WaterInfoFetchingMethod = BodyTriangulationResult.BodyProcessingResult->WaterPhysicsSettings->WaterInfoFetchingMethod;
+
 	FFetchWaterSurfaceInfoResult Result;
 	Result.BodyProcessingResult    = BodyTriangulationResult.BodyProcessingResult;
 	Result.BodyTriangulationResult = &BodyTriangulationResult;
-	Result.VertexWaterInfo = FetchVerticesWaterInfo(Component, BodyTriangulationResult.TriangulatedBody.VertexList, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
+
+	if (!BodyTriangulationResult.IsAnalytic() && WaterInfoFetchingMethod != EWaterInfoFetchingMethod::PerVertex)
+	{
+		Result.WaterState = ClassifyBodyWaterState(Component, BodyTriangulationResult, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider, Result.BodyWaterInfo);
+		if (Result.WaterState != EBodyWaterState::Partial)
+			return Result;
+
+		// Every vertex uses the one sample we already have
+		if (WaterInfoFetchingMethod == EWaterInfoFetchingMethod::PerObject)
+		{
+			Result.VertexWaterInfo.Init(Result.BodyWaterInfo, BodyTriangulationResult.LocalMesh->VertexList.Num());
+			return Result;
+		}
+	}
+
+	if (BodyTriangulationResult.IsAnalytic())
+	{
+		Result.VertexWaterInfo = FetchVerticesWaterInfo(Component, BodyTriangulationResult.AnalyticSamplePoints, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
+		return Result;
+	}
+
+	// Only the points we query the water at are moved into world space
+	const FVertexList WorldVertices = TransformVerticesToWorld(BodyTriangulationResult.LocalMesh->VertexList, BodyTriangulationResult.BodyTransform);
+	Result.VertexWaterInfo = FetchVerticesWaterInfo(Component, WorldVertices, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
 	return Result;
 }
 
@@ -1001,19 +2892,185 @@ FWaterPhysicsScene::FBodyWaterIntersectionResult FWaterPhysicsScene::BodyWaterIn
 	Result.BodyProcessingResult        = FetchWaterSurfaceInfoResult.BodyProcessingResult;
 	Result.BodyTriangulationResult     = FetchWaterSurfaceInfoResult.BodyTriangulationResult;
 	Result.FetchWaterSurfaceInfoResult = &FetchWaterSurfaceInfoResult;
-	Result.SubmergedTriangleArray = PerformTriangleMeshWaterIntersection(FetchWaterSurfaceInfoResult.VertexWaterInfo, FetchWaterSurfaceInfoResult.BodyTriangulationResult->TriangulatedBody);
+
+	const FBodyTriangulationResult& BodyTriangulationResult = *FetchWaterSurfaceInfoResult.BodyTriangulationResult;
+	if (BodyTriangulationResult.IsAnalytic() || FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Dry)
+		return Result;
+
+	// The water is sampled in world space, while the body is clipped and integrated in its own space
+	const FTransform& BodyTransform = BodyTriangulationResult.BodyTransform;
+	if (FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Submerged)
+	{
+		Result.LocalBodyWaterInfo = WaterInfoToBodySpace(FetchWaterSurfaceInfoResult.BodyWaterInfo, BodyTransform);
+	}
+	else
+	{
+		const int32 NumVertices = FetchWaterSurfaceInfoResult.VertexWaterInfo.Num();
+		Result.LocalVertexWaterInfo.SetNumUninitialized(NumVertices);
+
+		// The surface plane of each vertex in float SoA, the layout CalcVertexWaterDepths reads
+		TInlineFrameArray<float, InlineAllocSize()> PlaneNormalX, PlaneNormalY, PlaneNormalZ, PlaneW;
+		PlaneNormalX.SetNumUninitialized(NumVertices);
+		PlaneNormalY.SetNumUninitialized(NumVertices);
+		PlaneNormalZ.SetNumUninitialized(NumVertices);
+		PlaneW.SetNumUninitialized(NumVertices);
+
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FGetWaterInfoResult& WaterInfo = Result.LocalVertexWaterInfo[i] = WaterInfoToBodySpace(FetchWaterSurfaceInfoResult.VertexWaterInfo[i], BodyTransform);
+			PlaneNormalX[i] = (float)WaterInfo.WaterSurfaceNormal.X;
+			PlaneNormalY[i] = (float)WaterInfo.WaterSurfaceNormal.Y;
+			PlaneNormalZ[i] = (float)WaterInfo.WaterSurfaceNormal.Z;
+			PlaneW[i]       = (float)FVector::DotProduct(WaterInfo.WaterSurfaceLocation, WaterInfo.WaterSurfaceNormal);
+		}
+
+		const FBodyLocalMesh& LocalMesh = *BodyTriangulationResult.LocalMesh;
+		check(LocalMesh.VertexX.Num() == NumVertices);
+
+		Result.VertexDepths.SetNumUninitialized(NumVertices);
+		Result.SubmergedMask.SetNumUninitialized(FMath::DivideAndRoundUp(NumVertices, 32));
+		CalcVertexWaterDepths(LocalMesh.VertexX.GetData(), LocalMesh.VertexY.GetData(), LocalMesh.VertexZ.GetData(), 
+			PlaneNormalX.GetData(), PlaneNormalY.GetData(), PlaneNormalZ.GetData(), PlaneW.GetData(), NumVertices, Result.VertexDepths.GetData(), Result.SubmergedMask.GetData());
+	}
+
+	// The fused evaluation clips the triangles while calculating the forces
+	if (FetchWaterSurfaceInfoResult.BodyProcessingResult->WaterPhysicsSettings->EvaluationMode == EWaterPhysicsEvaluationMode::Fused)
+		return Result;
+
+	const FBodyLocalMesh&        LocalMesh            = *BodyTriangulationResult.LocalMesh;
+	const FTessellationSettings& TessellationSettings = FetchWaterSurfaceInfoResult.BodyProcessingResult->WaterPhysicsSettings->SubmergedTessellationSettings;
+
+	Result.bSinglePrecision = FetchWaterSurfaceInfoResult.BodyProcessingResult->WaterPhysicsSettings->bBodyRelativePrecision;
+	Result.VisitSubmergedTriangles([&](auto& SubmergedTriangles)
+	{
+		typedef typename std::decay_t<decltype(SubmergedTriangles)>::FVec FVec;
+
+		if (FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Submerged)
+			SubmergedTriangles = MakeSubmergedTriangleArray<FVec>(Result.LocalBodyWaterInfo, LocalMesh);
+		else
+			SubmergedTriangles = PerformTriangleMeshWaterIntersection<FVec>(Result.LocalVertexWaterInfo, LocalMesh, Result.VertexDepths, Result.SubmergedMask);
+
+		// The inserted vertices only get an estimate of the water from the vertices of their edge, see SampleSubmergedTessellation
+		Result.NumSampledVertices = SubmergedTriangles.VertexList.Num();
+
+		if (TessellationSettings.TessellationMode != EWaterPhysicsTessellationMode::Levels || TessellationSettings.Levels > 0)
+			TessellateTriangles(SubmergedTriangles, TessellationSettings);
+	});
+
 	return Result;
 }
 
-void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component, FWaterPhysicsBody& WaterBody, 
-	const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, float DeltaTime, const FVector& Gravity)
+void FWaterPhysicsScene::SampleSubmergedTessellation(const UActorComponent* Component, FBodyWaterIntersectionResult& BodyWaterIntersectionResult, 
+	const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
+{
+	const int32 NumSampledVertices = BodyWaterIntersectionResult.NumSampledVertices;
+	const int32 NumVertices        = BodyWaterIntersectionResult.VisitSubmergedTriangles([](const auto& SubmergedTriangles) { return SubmergedTriangles.VertexList.Num(); });
+	if (NumVertices == NumSampledVertices)
+		return;
+
+	// Every vertex of a submerged body, and every vertex fetched per object, shares one sample. The surface is then a plane which the
+	// inserted vertices already follow exactly.
+	const EWaterInfoFetchingMethod WaterInfoFetchingMethod = BodyWaterIntersectionResult.BodyProcessingResult->WaterPhysicsSettings->WaterInfoFetchingMethod;
+	if (BodyWaterIntersectionResult.FetchWaterSurfaceInfoResult->WaterState == EBodyWaterState::Submerged || WaterInfoFetchingMethod == EWaterInfoFetchingMethod::PerObject)
+		return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(SampleSubmergedTessellation);
+
+	const FTransform& BodyTransform = BodyWaterIntersectionResult.BodyTriangulationResult->BodyTransform;
+
+	BodyWaterIntersectionResult.VisitSubmergedTriangles([&](auto& SubmergedTriangles)
+	{
+		typedef typename std::decay_t<decltype(SubmergedTriangles)>::FVec FVec;
+
+		FVertexList InsertedVertices;
+		InsertedVertices.Reserve(NumVertices - NumSampledVertices);
+		for (int32 i = NumSampledVertices; i < NumVertices; i++)
+			InsertedVertices.Add(BodyTransform.TransformPositionNoScale(FVector(SubmergedTriangles.VertexList[i].Position)));
+
+		const FWaterSurfaceProvider::FVertexWaterInfoArray VertexWaterInfo = FetchVerticesWaterInfo(Component, InsertedVertices, WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
+
+		for (int32 i = 0; i < InsertedVertices.Num(); i++)
+		{
+			auto&                     Vertex    = SubmergedTriangles.VertexList[NumSampledVertices + i];
+			const FGetWaterInfoResult WaterInfo = WaterInfoToBodySpace(VertexWaterInfo[i], BodyTransform);
+
+			// Same depth as CalcVertexWaterDepths, along the surface normal. The triangles were clipped against the coarse surface, 
+			// an inserted vertex which turns out to be above the water gets no pressure.
+			Vertex.Depth              = FMath::Max(0.f, (float)FVector::DotProduct(WaterInfo.WaterSurfaceLocation - FVector(Vertex.Position), WaterInfo.WaterSurfaceNormal));
+			Vertex.WaterVelocity      = FVec(WaterInfo.WaterVelocity);
+			Vertex.WaterSurfaceNormal = FVec(WaterInfo.WaterSurfaceNormal);
+		}
+	});
+}
+
+void FWaterPhysicsScene::ApplyBodyForces(TArrayView<const FBodyForceOutput> BodyForces)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(ApplyBodyForces);
+
+	TArray<FPhysScene*, TInlineAllocator<4>> PhysicsScenes;
+	for (const FBodyForceOutput& BodyForce : BodyForces)
+	{
+		if (BodyForce.BodyInstance)
+			PhysicsScenes.AddUnique(BodyForce.BodyInstance->GetPhysicsScene());
+	}
+
+	for (FPhysScene* PhysicsScene : PhysicsScenes)
+	{
+		const auto ForEachBodyInScene = [&](TFunctionRef<void(const FBodyForceOutput&)> Callable)
+		{
+			for (const FBodyForceOutput& BodyForce : BodyForces)
+			{
+				if (BodyForce.BodyInstance && BodyForce.BodyInstance->GetPhysicsScene() == PhysicsScene)
+					Callable(BodyForce);
+			}
+		};
+
+		const bool bWritten = PhysicsScene && FPhysicsCommand::ExecuteWrite(PhysicsScene, [&]()
+		{
+			ForEachBodyInScene([](const FBodyForceOutput& BodyForce)
+			{
+				const FPhysicsActorHandle& ActorHandle = BodyForce.BodyInstance->GetPhysicsActorHandle();
+				if (!FPhysicsInterface::IsValid(ActorHandle))
+					return;
+
+				if (!BodyForce.Force.IsNearlyZero())
+					FPhysicsInterface::AddForce_AssumesLocked(ActorHandle, BodyForce.Force, false, false);
+
+				if (!BodyForce.Torque.IsNearlyZero())
+					FPhysicsInterface::AddTorque_AssumesLocked(ActorHandle, BodyForce.Torque, false, false);
+			});
+		});
+
+		// Without a scene to lock every body takes its own lock
+		if (!bWritten)
+		{
+			ForEachBodyInScene([](const FBodyForceOutput& BodyForce)
+			{
+				BodyForce.BodyInstance->AddForce(BodyForce.Force, false);
+				BodyForce.BodyInstance->AddTorqueInRadians(BodyForce.Torque, false);
+			});
+		}
+	}
+}
+
+void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component, int32 BodyIndex, 
+	const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce)
 {
+	if (BodyWaterIntersectionResult.BodyTriangulationResult->IsAnalytic())
+	{
+		CalculateAnalyticWaterForces(Component, BodyIndex, *BodyWaterIntersectionResult.FetchWaterSurfaceInfoResult, DeltaTime, Gravity, OutBodyForce);
+		return;
+	}
+
 	TRACE_CPUPROFILER_EVENT_SCOPE(CalculateWaterForces);
 
-	const FIndexedTriangleMesh&    TriangulatedBody   = BodyWaterIntersectionResult.BodyTriangulationResult->TriangulatedBody;
-	const FSubmergedTriangleArray& SubmergedTriangles = BodyWaterIntersectionResult.SubmergedTriangleArray;
-	const FWaterPhysicsSettings&   Settings           = BodyWaterIntersectionResult.BodyProcessingResult->WaterPhysicsSettings;
-	FBodyInstance*                 BodyInstance       = BodyWaterIntersectionResult.BodyProcessingResult->BodyInstance->WeldParent 
+	FWaterPhysicsBody& WaterBody    = Bodies[BodyIndex];
+	FActingForces&     ActingForces = BodyActingForces[BodyIndex];
+
+	const FBodyTriangulationResult& TriangulationResult = *BodyWaterIntersectionResult.BodyTriangulationResult;
+	const FBodyLocalMesh&           LocalMesh           = *TriangulationResult.LocalMesh;
+	const FWaterPhysicsSettings&    Settings            = *BodyWaterIntersectionResult.BodyProcessingResult->WaterPhysicsSettings;
+	FBodyInstance*                  BodyInstance        = BodyWaterIntersectionResult.BodyProcessingResult->BodyInstance->WeldParent 
 															? BodyWaterIntersectionResult.BodyProcessingResult->BodyInstance->WeldParent 
 															: BodyWaterIntersectionResult.BodyProcessingResult->BodyInstance;
 
@@ -1025,22 +3082,39 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 	DEBUG_CAPTURE_USTRUCT("Water Physics Settings", Settings);
 
-	// Avoid acquiring expensive PhysicsLock more than we need to
-	FVector    BodyLinearVelocity;
-	FVector    BodyAngularVelocity;
-	FVector    BodyCenterOfMass;
-	float      BodyMass;
-	FVector    BodyInertiaTensor;
-	FTransform BodyTransform(NoInit);
-	FPhysicsCommand::ExecuteRead(BodyInstance->GetPhysicsActorHandle(), [&](const FPhysicsActorHandle& ActorHandle)
-	{
-		BodyLinearVelocity  = FPhysicsInterface::GetLinearVelocity_AssumesLocked(ActorHandle);
-		BodyAngularVelocity = FPhysicsInterface::GetAngularVelocity_AssumesLocked(ActorHandle);
-		BodyCenterOfMass    = FPhysicsInterface::GetComTransform_AssumesLocked(ActorHandle).GetLocation();
-		BodyMass            = FPhysicsInterface::GetMass_AssumesLocked(ActorHandle);
-		BodyInertiaTensor   = FPhysicsInterface::GetLocalInertiaTensor_AssumesLocked(ActorHandle);
-		BodyTransform       = BodyInstance->GetUnrealWorldTransform_AssumesLocked();
-	});
+	const FFetchWaterSurfaceInfoResult& FetchWaterSurfaceInfoResult = *BodyWaterIntersectionResult.FetchWaterSurfaceInfoResult;
+
+	// Nothing acts on a body which is entirely out of the water, no need to even read its physics state
+	if (FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Dry)
+	{
+		BodyTriangleFrames[BodyIndex].Empty();
+		WaterBody.SubmergedArea = 0.f;
+		ActingForces            = FActingForces(ForceInit);
+		return;
+	}
+
+	if (Settings.EvaluationMode == EWaterPhysicsEvaluationMode::Fused)
+	{
+		CalculateFusedWaterForces(Component, BodyIndex, BodyWaterIntersectionResult, DeltaTime, Gravity, OutBodyForce);
+		return;
+	}
+
+	// Go back to the analytic evaluation once the water around the body is planar again
+	if (WaterBody.bAnalyticFallback && Settings.EvaluationMode == EWaterPhysicsEvaluationMode::Analytic)
+	{
+		FPlane  WaterPlane;
+		FVector WaterVelocity;
+		WaterBody.bAnalyticFallback = !FitWaterPlane(BodyWaterIntersectionResult.FetchWaterSurfaceInfoResult->VertexWaterInfo, Settings.AnalyticMaxSurfaceDeviation, WaterPlane, WaterVelocity);
+	}
+
+	// Read for all bodies at once by ReadBodyStates
+	const FBodyState& BodyState           = BodyWaterIntersectionResult.BodyProcessingResult->BodyState;
+	const FVector&    BodyLinearVelocity  = BodyState.LinearVelocity;
+	const FVector&    BodyAngularVelocity = BodyState.AngularVelocity;
+	const FVector&    BodyCenterOfMass    = BodyState.CenterOfMass;
+	const float       BodyMass            = BodyState.Mass;
+	const FVector&    BodyInertiaTensor   = BodyState.InertiaTensor;
+	const FTransform& BodyTransform       = BodyState.Transform;
 
 	DEBUG_CAPTURE_STRING("BodyLinearVelocity", BodyLinearVelocity.ToString());
 	DEBUG_CAPTURE_STRING("BodyAngularVelocity", BodyAngularVelocity.ToString());
@@ -1049,7 +3123,38 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 	DEBUG_CAPTURE_STRING("BodyTransform", BodyTransform.ToString());
 	DEBUG_CAPTURE_NUMBER("BodyMass", BodyMass);
 
-	const auto PersistantBodyFrame = InitFrame(WaterBody, TriangulatedBody, SubmergedTriangles, BodyCenterOfMass, BodyLinearVelocity, BodyAngularVelocity);
+	// The triangles are in the space of the body and so is everything they are integrated against, only the totals are moved into world space
+	const FTransform& LocalToWorld         = TriangulationResult.BodyTransform;
+	const FVector     LocalCenterOfMass    = LocalToWorld.InverseTransformPositionNoScale(BodyCenterOfMass);
+	const FVector     LocalLinearVelocity  = LocalToWorld.InverseTransformVectorNoScale(BodyLinearVelocity);
+	const FVector     LocalAngularVelocity = LocalToWorld.InverseTransformVectorNoScale(BodyAngularVelocity);
+	const FVector     LocalGravity         = LocalToWorld.InverseTransformVectorNoScale(Gravity);
+
+	const bool bVolumeBuoyancy = FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Submerged && LocalMesh.bClosed;
+
+	// The SIMD kernels have no per triangle debug output, forces which are debugged per triangle use the scalar loops
+	const auto UseForceKernel = [&](bool bEnabled, EWaterPhysicsDebugLevel DebugLevel)
+	{
+		return !WATER_PHYS_SCALAR_FORCE_KERNELS && bEnabled && DebugLevel <= EWaterPhysicsDebugLevel::Normal;
+	};
+	const bool bBuoyancyEnabled    = Settings.bEnableBuoyancyForce && !bVolumeBuoyancy;
+	const bool bBuoyancyKernel     = UseForceKernel(bBuoyancyEnabled, Settings.DebugBuoyancyForce);
+	const bool bResistanceKernel   = UseForceKernel(Settings.bEnableViscousFluidResistance, Settings.DebugViscousFluidResistance);
+	const bool bPressureDragKernel = UseForceKernel(Settings.bEnablePressureDragForce, Settings.DebugPressureDragForce);
+	const bool bSlammingKernel     = UseForceKernel(Settings.bEnableSlammingForce, Settings.DebugSlammingForce);
+
+	// Only the layouts read by the enabled forces are set up
+	const bool bTriangleDataSoA = bBuoyancyKernel || bResistanceKernel || bPressureDragKernel || bSlammingKernel;
+	const bool bTriangleData    = (bBuoyancyEnabled && !bBuoyancyKernel) 
+		|| (Settings.bEnableViscousFluidResistance && !bResistanceKernel) 
+		|| (Settings.bEnablePressureDragForce && !bPressureDragKernel) 
+		|| (Settings.bEnableSlammingForce && !bSlammingKernel);
+
+	const auto PersistantBodyFrame = BodyWaterIntersectionResult.VisitSubmergedTriangles([&](const auto& SubmergedTriangles)
+	{
+		return InitFrame(BodyTriangleFrames[BodyIndex], LocalMesh, SubmergedTriangles, LocalCenterOfMass, LocalLinearVelocity, LocalAngularVelocity, 
+			bTriangleData, bTriangleDataSoA, Settings.ParallelTriangleThreshold);
+	});
 
 	if (!PersistantBodyFrame.bSuccess)
 	{
@@ -1059,21 +3164,40 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 	WaterBody.SubmergedArea = PersistantBodyFrame.TotalSubmergedArea;
 
+	const FTriangleDataSoA& TriangleDataSoA = PersistantBodyFrame.TriangleDataSoA;
+
 	UWorld* World = Component->GetWorld();
 
 	// Debug Draw submersion
 	EXEC_WITH_WATER_PHYS_DEBUG(([&]()
 	{
+		// The game thread draws after the step, copy the submerged vertices out of the frame arena in world space
+		TArray<FVector> SubmergedPositions;
+		TArray<FVector> SubmergedWaterVelocities;
+		TArray<FSubmergedTriangle> SubmergedTriangleList;
+		if (Settings.DebugSubmersion > EWaterPhysicsDebugLevel::None || Settings.DebugFluidVelocity > EWaterPhysicsDebugLevel::None)
+		{
+			BodyWaterIntersectionResult.VisitSubmergedTriangles([&](const auto& SubmergedTriangles)
+			{
+				for (const auto& Vertex : SubmergedTriangles.VertexList)
+				{
+					SubmergedPositions.Add(LocalToWorld.TransformPositionNoScale(FVector(Vertex.Position)));
+					SubmergedWaterVelocities.Add(LocalToWorld.TransformVectorNoScale(FVector(Vertex.WaterVelocity)));
+				}
+				SubmergedTriangleList.Append(SubmergedTriangles.TriangleList);
+			});
+		}
+
 		if (Settings.DebugSubmersion > EWaterPhysicsDebugLevel::None)
 		{
-			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=]()
+			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=, VertexList = SubmergedPositions, TriangleList = SubmergedTriangleList]()
 			{
-				for (int32 i = 0; i < SubmergedTriangles.TriangleList.Num(); ++i)
+				for (int32 i = 0; i < TriangleList.Num(); ++i)
 				{
 					const FVector Vertices[3] = {
-						SubmergedTriangles.VertexList[SubmergedTriangles.TriangleList[i].Indices[0]].Position,
-						SubmergedTriangles.VertexList[SubmergedTriangles.TriangleList[i].Indices[1]].Position,
-						SubmergedTriangles.VertexList[SubmergedTriangles.TriangleList[i].Indices[2]].Position
+						VertexList[TriangleList[i].Indices[0]],
+						VertexList[TriangleList[i].Indices[1]],
+						VertexList[TriangleList[i].Indices[2]]
 					};
 
 					DrawDebugTriangle(World, Vertices, Settings.DebugSubmersion > EWaterPhysicsDebugLevel::Normal, FColor::Red, false, 0.f, -1, 3.f);
@@ -1083,14 +3207,14 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		if (Settings.DebugTriangleData > EWaterPhysicsDebugLevel::None)
 		{
-			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=]()
+			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=, SharedLocalMesh = TriangulationResult.LocalMesh]()
 			{
-				for (int32 i = 0; i < TriangulatedBody.IndexList.Num(); i += 3)
+				for (int32 i = 0; i < SharedLocalMesh->IndexList.Num(); i += 3)
 				{
 					const FVector Vertices[3] = {
-						TriangulatedBody.VertexList[TriangulatedBody.IndexList[i + 0]],
-						TriangulatedBody.VertexList[TriangulatedBody.IndexList[i + 1]],
-						TriangulatedBody.VertexList[TriangulatedBody.IndexList[i + 2]]
+						LocalToWorld.TransformPositionNoScale(SharedLocalMesh->VertexList[SharedLocalMesh->IndexList[i + 0]]),
+						LocalToWorld.TransformPositionNoScale(SharedLocalMesh->VertexList[SharedLocalMesh->IndexList[i + 1]]),
+						LocalToWorld.TransformPositionNoScale(SharedLocalMesh->VertexList[SharedLocalMesh->IndexList[i + 2]])
 					};
 
 					DrawDebugTriangle(World, Vertices, Settings.DebugTriangleData > EWaterPhysicsDebugLevel::Normal, FColor::Yellow, false, 0.f, -1, 1.5f);
@@ -1100,17 +3224,17 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		if (Settings.DebugFluidVelocity > EWaterPhysicsDebugLevel::None)
 		{
-			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=]()
+			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD(([=, 
+				AvgFluidVelocity = LocalToWorld.TransformVectorNoScale(PersistantBodyFrame.AvgFluidVelocity), 
+				VertexList       = SubmergedPositions,
+				WaterVelocities  = SubmergedWaterVelocities]()
 			{
-				DrawDebugLine(World, BodyCenterOfMass, BodyCenterOfMass + PersistantBodyFrame.AvgFluidVelocity * 100.f, FColor::Green, false, 0.f, -1, 4);
+				DrawDebugLine(World, BodyCenterOfMass, BodyCenterOfMass + AvgFluidVelocity * 100.f, FColor::Green, false, 0.f, -1, 4);
 
 				if (Settings.DebugFluidVelocity > EWaterPhysicsDebugLevel::Normal)
 				{
-					for (int32 i = 0; i < SubmergedTriangles.VertexList.Num(); ++i)
-					{
-						const auto& Vertex = SubmergedTriangles.VertexList[i];
-						DrawDebugLine(World, Vertex.Position, Vertex.Position + Vertex.WaterVelocity, FColor::Green, false, 0.f, -1, 2);
-					}
+					for (int32 i = 0; i < VertexList.Num(); ++i)
+						DrawDebugLine(World, VertexList[i], VertexList[i] + WaterVelocities[i], FColor::Green, false, 0.f, -1, 2);
 				}
 			}));
 		}
@@ -1125,30 +3249,47 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 		TRACE_CPUPROFILER_EVENT_SCOPE(CalcBuoyancy);
 		SCOPED_OBJECT_DATA_CAPTURE(TEXT("Buoyancy"), TEXT("Buoyancy"));
 		
-		for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+		if (bVolumeBuoyancy)
 		{
-			// NOTE: We do not multiply with 100 (N -> cN) since Gravity is supplied in cm/s instead of m/s
-			const auto BuoyancyForce = Gravity * TriangleData.AvgDepth * TriangleData.Area * Settings.FluidDensity * TriangleData.Normal;
-			TotalBuoyancyForce.AddForce(BuoyancyForce, TriangleData.Centroid, BodyCenterOfMass);
-			
-			EXEC_WITH_WATER_PHYS_DEBUG(
+			// The pressure integral over a closed, fully submerged mesh is its displaced volume acting at the centroid of that volume
+			TotalBuoyancyForce.AddForce(-LocalGravity * Settings.FluidDensity * LocalMesh.Volume * 0.000001f /* cm3 -> m3 */, LocalMesh.Centroid, LocalCenterOfMass);
+		}
+		else if (bBuoyancyKernel)
+		{
+			TotalBuoyancyForce = SumForceKernelRanges(TriangleDataSoA, Settings.ParallelTriangleThreshold, [&](int32 FirstTriangle, int32 EndTriangle)
 			{
-				SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("Buoyancy"), BuoyancyForce.Size() / 2000.f);
-				DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
-				DEBUG_CAPTURE_NUMBER("AvgDepth", TriangleData.AvgDepth);
-				DEBUG_CAPTURE_STRING("Force", BuoyancyForce.ToString());
-				DEBUG_CAPTURE_STRING("Torque", FVector::CrossProduct(TriangleData.Centroid - BodyCenterOfMass, BuoyancyForce).ToString());
-
-				if (Settings.DebugBuoyancyForce > EWaterPhysicsDebugLevel::Normal)
+				return CalcBuoyancyForce_SIMD(TriangleDataSoA, FirstTriangle, EndTriangle, LocalGravity, Settings.FluidDensity, LocalCenterOfMass);
+			});
+		}
+		else
+		{
+			for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+			{
+				// NOTE: We do not multiply with 100 (N -> cN) since Gravity is supplied in cm/s instead of m/s
+				const auto BuoyancyForce = LocalGravity * TriangleData.AvgDepth * TriangleData.Area * Settings.FluidDensity * TriangleData.Normal;
+				TotalBuoyancyForce.AddForce(BuoyancyForce, TriangleData.Centroid, LocalCenterOfMass);
+			
+				EXEC_WITH_WATER_PHYS_DEBUG(
 				{
-					EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
+					SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("Buoyancy"), BuoyancyForce.Size() / 2000.f);
+					DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
+					DEBUG_CAPTURE_NUMBER("AvgDepth", TriangleData.AvgDepth);
+					DEBUG_CAPTURE_STRING("Force", LocalToWorld.TransformVectorNoScale(BuoyancyForce).ToString());
+					DEBUG_CAPTURE_STRING("Torque", LocalToWorld.TransformVectorNoScale(FVector::CrossProduct(TriangleData.Centroid - LocalCenterOfMass, BuoyancyForce)).ToString());
+
+					if (Settings.DebugBuoyancyForce > EWaterPhysicsDebugLevel::Normal)
 					{
-						DrawDebugLine(World, TriangleData.Centroid, TriangleData.Centroid + BuoyancyForce / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
-					});
-				}
-			});
+						EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=, Centroid = LocalToWorld.TransformPositionNoScale(TriangleData.Centroid), Force = LocalToWorld.TransformVectorNoScale(BuoyancyForce)]()
+						{
+							DrawDebugLine(World, Centroid, Centroid + Force / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
+						});
+					}
+				});
+			}
 		}
 
+		TotalBuoyancyForce = ToWorldForce(TotalBuoyancyForce, LocalToWorld);
+
 		EXEC_WITH_WATER_PHYS_DEBUG(
 		{
 			DEBUG_CAPTURE_STRING("GravityZ", Gravity.ToString());
@@ -1166,8 +3307,8 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		TotalWaterPhysicsForce += TotalBuoyancyForce;
 	}
-	WaterBody.ActingForces.BuoyancyForce = TotalBuoyancyForce.Force;
-	WaterBody.ActingForces.BuoyancyTorque = TotalBuoyancyForce.Torque;
+	ActingForces.BuoyancyForce = TotalBuoyancyForce.Force;
+	ActingForces.BuoyancyTorque = TotalBuoyancyForce.Torque;
 
 	// Viscous Fluid Resistance
 	FForce TotalResistanceForce(ForceInit);
@@ -1186,12 +3327,15 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 			const FVector RelativeVelocityNormal = FMath::IsNearlyZero(RelativeVelocitySize) ? FVector::UpVector : RelativeVelocity.GetSafeNormal();
 			float MinVertexDistanceToVelocityPlane = BIG_NUMBER;
 			float MaxVertexDistanceToVelocityPlane = -BIG_NUMBER;
-			for (const auto& Vertex : SubmergedTriangles.VertexList)
+			BodyWaterIntersectionResult.VisitSubmergedTriangles([&](const auto& SubmergedTriangles)
 			{
-				const float DistToVelocityPlane = FVector::PointPlaneDist(Vertex.Position, BodyCenterOfMass, RelativeVelocityNormal);
-				MinVertexDistanceToVelocityPlane = FMath::Min(DistToVelocityPlane, MinVertexDistanceToVelocityPlane);
-				MaxVertexDistanceToVelocityPlane = FMath::Max(DistToVelocityPlane, MaxVertexDistanceToVelocityPlane);
-			}
+				for (const auto& Vertex : SubmergedTriangles.VertexList)
+				{
+					const float DistToVelocityPlane = FVector::PointPlaneDist(FVector(Vertex.Position), LocalCenterOfMass, RelativeVelocityNormal);
+					MinVertexDistanceToVelocityPlane = FMath::Min(DistToVelocityPlane, MinVertexDistanceToVelocityPlane);
+					MaxVertexDistanceToVelocityPlane = FMath::Max(DistToVelocityPlane, MaxVertexDistanceToVelocityPlane);
+				}
+			});
 			return FMath::Max(1.f, MaxVertexDistanceToVelocityPlane - MinVertexDistanceToVelocityPlane) * 0.01f /* cm -> m */;
 		}();
 
@@ -1202,39 +3346,51 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 		const float Denominator = FMath::LogX(10.f, FMath::Max(5.f, Rn) + 100.f) - 2.f;
 		const float Cf = 0.075f / (Denominator * Denominator);
 		
-		for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
-		{
-			const FVector TangentalVelocity            = FVector::VectorPlaneProject(TriangleData.Velocity, TriangleData.Normal);
-			const float   TangentalVelocitySizeSquared = TriangleData.Velocity.SizeSquared();
-			const float   InverseTangentalVelocitySize = (TangentalVelocitySizeSquared > SMALL_NUMBER ? FMath::InvSqrt(TangentalVelocitySizeSquared) : 0.f);
-			const float   TangentalVelocitySize        = TangentalVelocitySizeSquared * InverseTangentalVelocitySize;
-			const FVector TangentalVelocityNormal      = InverseTangentalVelocitySize * TangentalVelocity;
-
-			// -0.5 * fluid_density * Cf * triangle_geometries[i].area * tangental_velocity_normal * tangental_velocity_size_squared;
-			const FVector ResistanceForce = 0.5f * Settings.FluidDensity * Cf * TriangleData.Area * -TangentalVelocityNormal * TangentalVelocitySizeSquared * 100.f /* N -> cN */;
-			TotalResistanceForce.AddForce(ResistanceForce, TriangleData.Centroid, BodyCenterOfMass);
-
-			EXEC_WITH_WATER_PHYS_DEBUG(
-			{
-				SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("Viscosity"), ResistanceForce.Size() / 2000.f);
-				DEBUG_CAPTURE_NUMBER("FluidTravelLength", FluidTravelLength);
-				DEBUG_CAPTURE_NUMBER("Rn", Rn);
-				DEBUG_CAPTURE_NUMBER("Cf", Cf);
-				DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
-				DEBUG_CAPTURE_NUMBER("TangentalVelocitySize", TangentalVelocitySize);
-				DEBUG_CAPTURE_STRING("Force", ResistanceForce.ToString());
-				DEBUG_CAPTURE_STRING("Torque", FVector::CrossProduct(TriangleData.Centroid - BodyCenterOfMass, ResistanceForce).ToString());
-
-				if (Settings.DebugViscousFluidResistance > EWaterPhysicsDebugLevel::Normal)
+		if (bResistanceKernel)
+		{
+			TotalResistanceForce = SumForceKernelRanges(TriangleDataSoA, Settings.ParallelTriangleThreshold, [&](int32 FirstTriangle, int32 EndTriangle)
+			{
+				return CalcViscousResistanceForce_SIMD(TriangleDataSoA, FirstTriangle, EndTriangle, 0.5f * Settings.FluidDensity * Cf * 100.f /* N -> cN */, LocalCenterOfMass);
+			});
+		}
+		else
+		{
+			for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+			{
+				const FVector TangentalVelocity            = FVector::VectorPlaneProject(TriangleData.Velocity, TriangleData.Normal);
+				const float   TangentalVelocitySizeSquared = TriangleData.Velocity.SizeSquared();
+				const float   InverseTangentalVelocitySize = (TangentalVelocitySizeSquared > SMALL_NUMBER ? FMath::InvSqrt(TangentalVelocitySizeSquared) : 0.f);
+				const float   TangentalVelocitySize        = TangentalVelocitySizeSquared * InverseTangentalVelocitySize;
+				const FVector TangentalVelocityNormal      = InverseTangentalVelocitySize * TangentalVelocity;
+
+				// -0.5 * fluid_density * Cf * triangle_geometries[i].area * tangental_velocity_normal * tangental_velocity_size_squared;
+				const FVector ResistanceForce = 0.5f * Settings.FluidDensity * Cf * TriangleData.Area * -TangentalVelocityNormal * TangentalVelocitySizeSquared * 100.f /* N -> cN */;
+				TotalResistanceForce.AddForce(ResistanceForce, TriangleData.Centroid, LocalCenterOfMass);
+
+				EXEC_WITH_WATER_PHYS_DEBUG(
 				{
-					EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
+					SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("Viscosity"), ResistanceForce.Size() / 2000.f);
+					DEBUG_CAPTURE_NUMBER("FluidTravelLength", FluidTravelLength);
+					DEBUG_CAPTURE_NUMBER("Rn", Rn);
+					DEBUG_CAPTURE_NUMBER("Cf", Cf);
+					DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
+					DEBUG_CAPTURE_NUMBER("TangentalVelocitySize", TangentalVelocitySize);
+					DEBUG_CAPTURE_STRING("Force", LocalToWorld.TransformVectorNoScale(ResistanceForce).ToString());
+					DEBUG_CAPTURE_STRING("Torque", LocalToWorld.TransformVectorNoScale(FVector::CrossProduct(TriangleData.Centroid - LocalCenterOfMass, ResistanceForce)).ToString());
+
+					if (Settings.DebugViscousFluidResistance > EWaterPhysicsDebugLevel::Normal)
 					{
-						DrawDebugLine(World, TriangleData.Centroid, TriangleData.Centroid + ResistanceForce / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
-					});
-				}
-			});
+						EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=, Centroid = LocalToWorld.TransformPositionNoScale(TriangleData.Centroid), Force = LocalToWorld.TransformVectorNoScale(ResistanceForce)]()
+						{
+							DrawDebugLine(World, Centroid, Centroid + Force / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
+						});
+					}
+				});
+			}
 		}
 
+		TotalResistanceForce = ToWorldForce(TotalResistanceForce, LocalToWorld);
+
 		EXEC_WITH_WATER_PHYS_DEBUG(
 		{
 			DEBUG_CAPTURE_STRING("Force", TotalResistanceForce.Force.ToString());
@@ -1251,8 +3407,8 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		TotalWaterPhysicsForce += TotalResistanceForce;
 	}
-	WaterBody.ActingForces.ViscousFluidResistanceForce = TotalResistanceForce.Force;
-	WaterBody.ActingForces.ViscousFluidResistanceTorque = TotalResistanceForce.Torque;
+	ActingForces.ViscousFluidResistanceForce = TotalResistanceForce.Force;
+	ActingForces.ViscousFluidResistanceTorque = TotalResistanceForce.Torque;
 
 	// Pressure Drag Forces
 	FForce TotalPressureDragForce(ForceInit);
@@ -1285,62 +3441,47 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 			1
 		};
 
-		for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+		if (bPressureDragKernel)
 		{
-			const float ReferenceVelocityRatio = TriangleData.VelocitySize / Settings.DragReferenceSpeed;
-			const FPreassureDragParams& P      = TriangleData.VelocityNormalDot > 0.f ? PressureDragParams : SuctionDragParams;
-			const auto DragForce               = P.Dir * (P.C1 * ReferenceVelocityRatio + P.C2 * ReferenceVelocityRatio * ReferenceVelocityRatio) 
-				* TriangleData.Area * FMath::Pow(FMath::Abs(TriangleData.VelocityNormalDot), P.F) * TriangleData.Normal * 100.f /* N -> cN */;
-			TotalPressureDragForce.AddForce(DragForce, TriangleData.Centroid, BodyCenterOfMass);
-
-			EXEC_WITH_WATER_PHYS_DEBUG(
+			TotalPressureDragForce = SumForceKernelRanges(TriangleDataSoA, Settings.ParallelTriangleThreshold, [&](int32 FirstTriangle, int32 EndTriangle)
 			{
-				SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("PressureDrag"), DragForce.Size() / 2000.f);
-				DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
-				DEBUG_CAPTURE_NUMBER("ReferenceVelocityRatio", ReferenceVelocityRatio);
-				DEBUG_CAPTURE_STRING("Force", DragForce.ToString());
-				DEBUG_CAPTURE_STRING("Torque", FVector::CrossProduct(TriangleData.Centroid - BodyCenterOfMass, DragForce).ToString());
-
-				if (Settings.DebugPressureDragForce > EWaterPhysicsDebugLevel::Normal)
-				{
-					EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
-					{
-						DrawDebugLine(World, TriangleData.Centroid, TriangleData.Centroid + DragForce / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
-					});
-				}
+				return CalcPressureDragForce_SIMD(TriangleDataSoA, FirstTriangle, EndTriangle, Settings, LocalCenterOfMass);
 			});
 		}
-
-		if (Settings.bEnableForceClamping)
-		{
-			const static auto ClampForce = [](FVector& InForce, const FVector& InMaxForce)
-			{
-				InForce.X = InForce.X > 0.f 
-					? FMath::Min(InForce.X, FMath::Max(0.f, -InMaxForce.X))
-					: FMath::Max(InForce.X, FMath::Min(0.f, -InMaxForce.X));
-				InForce.Y = InForce.Y > 0.f 
-					? FMath::Min(InForce.Y, FMath::Max(0.f, -InMaxForce.Y))
-					: FMath::Max(InForce.Y, FMath::Min(0.f, -InMaxForce.Y));
-				InForce.Z = InForce.Z > 0.f 
-					? FMath::Min(InForce.Z, FMath::Max(0.f, -InMaxForce.Z))
-					: FMath::Max(InForce.Z, FMath::Min(0.f, -InMaxForce.Z));
-			};
-
-			const FVector BodyLinearMomentum  = BodyMass * BodyLinearVelocity / DeltaTime;
-			const FVector WorldSpaceTensor    = [&]()
+		else
+		{
+			for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
 			{
-				const auto TensorMatrix        = FMatrix(FVector(BodyInertiaTensor.X, 0, 0), FVector(0, BodyInertiaTensor.Y, 0), FVector(0, 0, BodyInertiaTensor.Z), FVector(0, 0, 0));
-				const auto RotationMatrix      = FRotationMatrix::Make(BodyTransform.GetRotation());
-				const auto RotatedTensorMatrix = RotationMatrix * TensorMatrix * RotationMatrix.Inverse();
-				return FVector(RotatedTensorMatrix.M[0][0], RotatedTensorMatrix.M[1][1], RotatedTensorMatrix.M[2][2]);
-			}();
-			const FVector BodyAngularMomentum = WorldSpaceTensor * BodyAngularVelocity / DeltaTime;
+				const float ReferenceVelocityRatio = TriangleData.VelocitySize / Settings.DragReferenceSpeed;
+				const FPreassureDragParams& P      = TriangleData.VelocityNormalDot > 0.f ? PressureDragParams : SuctionDragParams;
+				const auto DragForce               = P.Dir * (P.C1 * ReferenceVelocityRatio + P.C2 * ReferenceVelocityRatio * ReferenceVelocityRatio) 
+					* TriangleData.Area * FMath::Pow(FMath::Abs(TriangleData.VelocityNormalDot), P.F) * TriangleData.Normal * 100.f /* N -> cN */;
+				TotalPressureDragForce.AddForce(DragForce, TriangleData.Centroid, LocalCenterOfMass);
+
+				EXEC_WITH_WATER_PHYS_DEBUG(
+				{
+					SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("PressureDrag"), DragForce.Size() / 2000.f);
+					DEBUG_CAPTURE_NUMBER("Area", TriangleData.Area);
+					DEBUG_CAPTURE_NUMBER("ReferenceVelocityRatio", ReferenceVelocityRatio);
+					DEBUG_CAPTURE_STRING("Force", LocalToWorld.TransformVectorNoScale(DragForce).ToString());
+					DEBUG_CAPTURE_STRING("Torque", LocalToWorld.TransformVectorNoScale(FVector::CrossProduct(TriangleData.Centroid - LocalCenterOfMass, DragForce)).ToString());
 
-			// Clamp Linear and angular forces
-			ClampForce(TotalPressureDragForce.Force, BodyLinearMomentum);
-			ClampForce(TotalPressureDragForce.Torque, BodyAngularMomentum);
+					if (Settings.DebugPressureDragForce > EWaterPhysicsDebugLevel::Normal)
+					{
+						EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=, Centroid = LocalToWorld.TransformPositionNoScale(TriangleData.Centroid), Force = LocalToWorld.TransformVectorNoScale(DragForce)]()
+						{
+							DrawDebugLine(World, Centroid, Centroid + Force / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
+						});
+					}
+				});
+			}
 		}
 
+		TotalPressureDragForce = ToWorldForce(TotalPressureDragForce, LocalToWorld);
+
+		if (Settings.bEnableForceClamping)
+			ClampDragForce(TotalPressureDragForce, DeltaTime, BodyMass, BodyInertiaTensor, BodyTransform.GetRotation(), BodyLinearVelocity, BodyAngularVelocity);
+
 		EXEC_WITH_WATER_PHYS_DEBUG(
 		{
 			DEBUG_CAPTURE_STRING("Force", TotalPressureDragForce.Force.ToString());
@@ -1358,8 +3499,8 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		TotalWaterPhysicsForce += TotalPressureDragForce;
 	}
-	WaterBody.ActingForces.PressureDragForce = TotalPressureDragForce.Force;
-	WaterBody.ActingForces.PressureDragTorque = TotalPressureDragForce.Torque;
+	ActingForces.PressureDragForce = TotalPressureDragForce.Force;
+	ActingForces.PressureDragTorque = TotalPressureDragForce.Torque;
 
 	// Slamming Force
 	FForce TotalSlammingForce(ForceInit);
@@ -1371,57 +3512,63 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 		const float TotalBodyArea = [&]()
 		{
 			float AggArea = 0.f;
-			for (int32 i = 0; i < TriangulatedBody.IndexList.Num(); i+=3)
+			for (int32 i = 0; i < LocalMesh.IndexList.Num(); i+=3)
 			{
 				const FVector* Vertices[3] = {
-					&TriangulatedBody.VertexList[TriangulatedBody.IndexList[i+0]],
-					&TriangulatedBody.VertexList[TriangulatedBody.IndexList[i+1]],
-					&TriangulatedBody.VertexList[TriangulatedBody.IndexList[i+2]]
+					&LocalMesh.VertexList[LocalMesh.IndexList[i+0]],
+					&LocalMesh.VertexList[LocalMesh.IndexList[i+1]],
+					&LocalMesh.VertexList[LocalMesh.IndexList[i+2]]
 				};
 				AggArea += CalcTriangleAreaM2(Vertices);
 			}
 			return AggArea;
 		}();
 
-		for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+		if (bSlammingKernel)
 		{
-			PersistantBodyFrame.CurrentFrame[TriangleData.OriginalTriangleIndex].SweptWaterArea += TriangleData.VelocityNormalDot > 0.f 
-				? TriangleData.Area * TriangleData.VelocitySize
-				: 0.f;
+			TotalSlammingForce = SumForceKernelRanges(TriangleDataSoA, Settings.ParallelTriangleThreshold, [&](int32 FirstTriangle, int32 EndTriangle)
+			{
+				return CalcSlammingForce_SIMD(TriangleDataSoA, FirstTriangle, EndTriangle, PersistantBodyFrame.CurrentFrame, PersistantBodyFrame.PreviousFrame, 
+					Settings, BodyMass, TotalBodyArea, DeltaTime, LocalCenterOfMass);
+			});
 		}
-
-		for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
+		else
 		{
-			if (TriangleData.VelocityNormalDot <= 0.f) // Triangle is receding from the water, no stopping force
-				continue;
-
-			const float   CurrSweptWaterVolume = PersistantBodyFrame.CurrentFrame[TriangleData.OriginalTriangleIndex].SweptWaterArea;
-			const float   PrevSweptWaterVolume = PersistantBodyFrame.PreviousFrame[TriangleData.OriginalTriangleIndex].SweptWaterArea;
-			const float   FlowAcceleration     = (CurrSweptWaterVolume - PrevSweptWaterVolume) / (TriangleData.Area * DeltaTime);
-			const FVector StoppingForce        = BodyMass * -TriangleData.Velocity * (2.f * TriangleData.Area / TotalBodyArea);
-			const FVector SlammingForce        = FMath::Clamp(FMath::Pow(FlowAcceleration / Settings.MaxSlammingForceAtAcceleration, Settings.SlammingForceExponent), 0.f, 1.f) 
-				* TriangleData.VelocityNormalDot * StoppingForce * 100.f /* N -> cN */;
-			TotalSlammingForce.AddForce(SlammingForce, TriangleData.Centroid, BodyCenterOfMass);
-
-			EXEC_WITH_WATER_PHYS_DEBUG(
+			for (const auto& TriangleData : PersistantBodyFrame.TriangleData)
 			{
-				SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("SlammingForce"), SlammingForce.Size() / 2000.f);
-				DEBUG_CAPTURE_NUMBER("CurrSweptWaterVolume", CurrSweptWaterVolume);
-				DEBUG_CAPTURE_NUMBER("PrevSweptWaterVolume", PrevSweptWaterVolume);
-				DEBUG_CAPTURE_NUMBER("FlowAcceleration", FlowAcceleration);
-				DEBUG_CAPTURE_STRING("Force", SlammingForce.ToString());
-				DEBUG_CAPTURE_STRING("Torque", FVector::CrossProduct(TriangleData.Centroid - BodyCenterOfMass, SlammingForce).ToString());
-
-				if (Settings.DebugSlammingForce > EWaterPhysicsDebugLevel::Normal)
+				if (TriangleData.VelocityNormalDot <= 0.f) // Triangle is receding from the water, no stopping force
+					continue;
+
+				const float   CurrSweptWaterVolume = PersistantBodyFrame.CurrentFrame[TriangleData.OriginalTriangleIndex].SweptWaterArea;
+				const float   PrevSweptWaterVolume = PersistantBodyFrame.PreviousFrame[TriangleData.OriginalTriangleIndex].SweptWaterArea;
+				const float   FlowAcceleration     = (CurrSweptWaterVolume - PrevSweptWaterVolume) / (TriangleData.Area * DeltaTime);
+				const FVector StoppingForce        = BodyMass * -TriangleData.Velocity * (2.f * TriangleData.Area / TotalBodyArea);
+				const FVector SlammingForce        = FMath::Clamp(FMath::Pow(FlowAcceleration / Settings.MaxSlammingForceAtAcceleration, Settings.SlammingForceExponent), 0.f, 1.f) 
+					* TriangleData.VelocityNormalDot * StoppingForce * 100.f /* N -> cN */;
+				TotalSlammingForce.AddForce(SlammingForce, TriangleData.Centroid, LocalCenterOfMass);
+
+				EXEC_WITH_WATER_PHYS_DEBUG(
 				{
-					EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
+					SCOPED_OBJECT_DATA_CAPTURE("Triangle Force", TEXT("SlammingForce"), SlammingForce.Size() / 2000.f);
+					DEBUG_CAPTURE_NUMBER("CurrSweptWaterVolume", CurrSweptWaterVolume);
+					DEBUG_CAPTURE_NUMBER("PrevSweptWaterVolume", PrevSweptWaterVolume);
+					DEBUG_CAPTURE_NUMBER("FlowAcceleration", FlowAcceleration);
+					DEBUG_CAPTURE_STRING("Force", LocalToWorld.TransformVectorNoScale(SlammingForce).ToString());
+					DEBUG_CAPTURE_STRING("Torque", LocalToWorld.TransformVectorNoScale(FVector::CrossProduct(TriangleData.Centroid - LocalCenterOfMass, SlammingForce)).ToString());
+
+					if (Settings.DebugSlammingForce > EWaterPhysicsDebugLevel::Normal)
 					{
-						DrawDebugLine(World, TriangleData.Centroid, TriangleData.Centroid + SlammingForce / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
-					});
-				}
-			});
+						EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=, Centroid = LocalToWorld.TransformPositionNoScale(TriangleData.Centroid), Force = LocalToWorld.TransformVectorNoScale(SlammingForce)]()
+						{
+							DrawDebugLine(World, Centroid, Centroid + Force / 1000.f, FColor::Yellow, false, 0.f, -1, 3);
+						});
+					}
+				});
+			}
 		}
 
+		TotalSlammingForce = ToWorldForce(TotalSlammingForce, LocalToWorld);
+
 		EXEC_WITH_WATER_PHYS_DEBUG(
 		{
 			DEBUG_CAPTURE_STRING("Force", TotalSlammingForce.Force.ToString());
@@ -1439,14 +3586,600 @@ void FWaterPhysicsScene::CalculateWaterForces(const UActorComponent* Component,
 
 		TotalWaterPhysicsForce += TotalSlammingForce;
 	}
-	WaterBody.ActingForces.SlammingForce = TotalSlammingForce.Force;
-	WaterBody.ActingForces.SlammingTorque = TotalSlammingForce.Torque;
+	ActingForces.SlammingForce = TotalSlammingForce.Force;
+	ActingForces.SlammingTorque = TotalSlammingForce.Torque;
+
+	OutBodyForce.BodyInstance = BodyInstance;
+	OutBodyForce.Force        = TotalWaterPhysicsForce.Force;
+	OutBodyForce.Torque       = TotalWaterPhysicsForce.Torque;
+}
+
+void FWaterPhysicsScene::CalculateFusedWaterForces(const UActorComponent* Component, int32 BodyIndex, 
+	const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CalculateFusedWaterForces);
+
+	FWaterPhysicsBody& WaterBody    = Bodies[BodyIndex];
+	FActingForces&     ActingForces = BodyActingForces[BodyIndex];
+
+	const FFetchWaterSurfaceInfoResult& FetchWaterSurfaceInfoResult = *BodyWaterIntersectionResult.FetchWaterSurfaceInfoResult;
+	const FBodyTriangulationResult&     TriangulationResult         = *FetchWaterSurfaceInfoResult.BodyTriangulationResult;
+	const FBodyLocalMesh&               LocalMesh                   = *TriangulationResult.LocalMesh;
+	const FWaterPhysicsSettings&        Settings                    = *FetchWaterSurfaceInfoResult.BodyProcessingResult->WaterPhysicsSettings;
+	FBodyInstance*                      BodyInstance                = FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance->WeldParent 
+																		? FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance->WeldParent 
+																		: FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance;
+
+	check(IsValid(Component) && BodyInstance);
+
+	// Read for all bodies at once by ReadBodyStates
+	const FBodyState& BodyState           = FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyState;
+	const FVector&    BodyLinearVelocity  = BodyState.LinearVelocity;
+	const FVector&    BodyAngularVelocity = BodyState.AngularVelocity;
+	const FVector&    BodyCenterOfMass    = BodyState.CenterOfMass;
+	const float       BodyMass            = BodyState.Mass;
+	const FVector&    BodyInertiaTensor   = BodyState.InertiaTensor;
+	const FTransform& BodyTransform       = BodyState.Transform;
+
+	// The mesh is never moved into world space, the body state is moved into the space of the mesh instead
+	const FTransform& LocalToWorld         = TriangulationResult.BodyTransform;
+	const FVector     LocalCenterOfMass    = LocalToWorld.InverseTransformPositionNoScale(BodyCenterOfMass);
+	const FVector     LocalLinearVelocity  = LocalToWorld.InverseTransformVectorNoScale(BodyLinearVelocity);
+	const FVector     LocalAngularVelocity = LocalToWorld.InverseTransformVectorNoScale(BodyAngularVelocity);
+	const FVector     LocalGravity         = LocalToWorld.InverseTransformVectorNoScale(Gravity);
+
+	const bool  bSubmerged   = FetchWaterSurfaceInfoResult.WaterState == EBodyWaterState::Submerged;
+	const int32 NumVertices  = LocalMesh.VertexList.Num();
+	const int32 NumTriangles = LocalMesh.IndexList.Num() / 3;
+
+	const auto GetWaterInfo = [&](int32 VertexIndex) -> const FGetWaterInfoResult&
+	{
+		return bSubmerged ? BodyWaterIntersectionResult.LocalBodyWaterInfo : BodyWaterIntersectionResult.LocalVertexWaterInfo[VertexIndex];
+	};
+
+	// Depth (cm) of each vertex below the water surface, negative above it
+	TInlineFrameArray<float, InlineAllocSize()> VertexDepths;
+	VertexDepths.SetNumUninitialized(NumVertices);
+
+	TInlineFrameArray<uint32, InlineAllocSize() / 32> SubmergedMask;
+	SubmergedMask.SetNumUninitialized(FMath::DivideAndRoundUp(NumVertices, 32));
+
+	if (bSubmerged)
+	{
+		const FGetWaterInfoResult& WaterInfo = BodyWaterIntersectionResult.LocalBodyWaterInfo;
+		for (int32 i = 0; i < NumVertices; ++i)
+			VertexDepths[i] = FMath::Max(0.f, (float)FVector::DotProduct(WaterInfo.WaterSurfaceLocation - LocalMesh.VertexList[i], WaterInfo.WaterSurfaceNormal));
+		FMemory::Memset(SubmergedMask.GetData(), 0xFF, SubmergedMask.Num() * sizeof(uint32));
+	}
+	else
+	{
+		// Already measured by BodyWaterIntersection
+		for (int32 i = 0; i < NumVertices; ++i)
+			VertexDepths[i] = -BodyWaterIntersectionResult.VertexDepths[i];
+		FMemory::Memcpy(SubmergedMask.GetData(), BodyWaterIntersectionResult.SubmergedMask.GetData(), SubmergedMask.Num() * sizeof(uint32));
+	}
+
+	const auto IsSubmerged = [&](int32 VertexIndex) { return (SubmergedMask[VertexIndex >> 5] & (1u << (VertexIndex & 31))) != 0; };
+
+	// Slamming needs the swept area of each original triangle from the previous step
+	TArray<FPersistentTriangleData>& CurrentFrame  = BodyTriangleFrames[BodyIndex].Frames[GetFrameIndex(Frame_Current)];
+	TArray<FPersistentTriangleData>& PreviousFrame = BodyTriangleFrames[BodyIndex].Frames[GetFrameIndex(Frame_Previous)];
+	if (Settings.bEnableSlammingForce)
+	{
+		CurrentFrame.SetNumUninitialized(NumTriangles);
+		FMemory::Memzero(CurrentFrame.GetData(), sizeof(FPersistentTriangleData) * CurrentFrame.Num());
+
+		if (PreviousFrame.Num() != CurrentFrame.Num())
+		{
+			PreviousFrame.SetNumUninitialized(CurrentFrame.Num());
+			FMemory::Memzero(PreviousFrame.GetData(), sizeof(FPersistentTriangleData) * PreviousFrame.Num());
+		}
+	}
+	else
+	{
+		BodyTriangleFrames[BodyIndex].Empty();
+	}
+
+	const bool  bVolumeBuoyancy = bSubmerged && LocalMesh.bClosed;
+	const float InvDragRefSpeed = 1.f / Settings.DragReferenceSpeed;
+
+	FForce  TotalBuoyancyForce(ForceInit);
+	FForce  TotalResistanceForce(ForceInit);   // Without 0.5 * FluidDensity * Cf, which is only known once all triangles have been visited
+	FForce  TotalPressureDragForce(ForceInit);
+	FForce  TotalSlammingForce(ForceInit);     // Without the division by the total body area
+	FVector AvgFluidVelocity   = FVector::ZeroVector;
+	FVector SubmergedLocalSize = FVector::ZeroVector; // Oriented with the body, so the fluid travel length does not grow with the rotation of the body
+	float   TotalSubmergedArea = 0.f;
+	float   TotalBodyArea      = 0.f;
+
+	// Clips and integrates every triangle in the space of the body. The vertices are either doubles or singles, 
+	// everything derived from them stays in that precision until the totals are moved into world space.
+	const auto IntegrateTriangles = [&](const auto& CenterOfMass)
+	{
+		using FVec  = std::decay_t<decltype(CenterOfMass)>;
+		using FReal = typename FVec::FReal;
+
+		const FVec GravityAcceleration(LocalGravity);
+		const FVec LinearVelocity(LocalLinearVelocity);
+		const FVec AngularVelocity(LocalAngularVelocity);
+
+		// Sums over a range of triangles
+		struct FPartialSums
+		{
+			TForce<FReal>         BuoyancyForce     = TForce<FReal>(ForceInit);
+			TForce<FReal>         ResistanceForce   = TForce<FReal>(ForceInit);
+			TForce<FReal>         PressureDragForce = TForce<FReal>(ForceInit);
+			TForce<FReal>         SlammingForce     = TForce<FReal>(ForceInit);
+			FVec                  FluidVelocity     = FVec::ZeroVector;
+			FBox3f                SubmergedBounds   = FBox3f(ForceInit);
+			float                 SubmergedArea     = 0.f;
+			float                 BodyArea          = 0.f;
+		};
+
+		struct FClipVertex
+		{
+			FVec      Position;
+			FVec      WaterVelocity;
+			float     Depth;
+		};
+
+		struct FPiece
+		{
+			FVec  Centroid;
+			float Area;
+			FVec  Velocity;
+			float VelocitySize;
+			float VelocityNormalDot;
+		};
+
+		const auto IntegrateRange = [&](int32 FirstTriangle, int32 EndTriangle, FPartialSums& Sums)
+		{
+			for (int32 TriangleIndex = FirstTriangle; TriangleIndex < EndTriangle; ++TriangleIndex)
+			{
+				const int32 Indices[3] = { 
+					LocalMesh.IndexList[TriangleIndex * 3 + 0], 
+					LocalMesh.IndexList[TriangleIndex * 3 + 1], 
+					LocalMesh.IndexList[TriangleIndex * 3 + 2] 
+				};
+				const FVec OriginalTriangleVertices[3] = { 
+					GetLocalVertex<FVec>(LocalMesh, Indices[0]), 
+					GetLocalVertex<FVec>(LocalMesh, Indices[1]), 
+					GetLocalVertex<FVec>(LocalMesh, Indices[2]) 
+				};
+
+				if (Settings.bEnableSlammingForce)
+					Sums.BodyArea += CalcTriangleAreaM2(OriginalTriangleVertices);
+
+				int32 Under[3], Over[3];
+				int32 NumUnder = 0, NumOver = 0;
+				for (int32 j = 0; j < 3; ++j)
+				{
+					if (IsSubmerged(Indices[j])) 
+						Under[NumUnder++] = Indices[j];
+					else
+						Over[NumOver++] = Indices[j];
+				}
+
+				if (NumUnder == 0)
+					continue;
+
+				const auto MakeVertex = [&](int32 VertexIndex)
+				{
+					return FClipVertex{ GetLocalVertex<FVec>(LocalMesh, VertexIndex), FVec(GetWaterInfo(VertexIndex).WaterVelocity), VertexDepths[VertexIndex] };
+				};
+
+				const auto MakeSplitVertex = [&](int32 IndexA, int32 IndexB)
+				{
+					const float AAbsDepth = FMath::Abs(VertexDepths[IndexA]);
+					const float Alpha     = AAbsDepth / (AAbsDepth + FMath::Abs(VertexDepths[IndexB]));
+					return FClipVertex{ 
+						FMath::Lerp(GetLocalVertex<FVec>(LocalMesh, IndexA), GetLocalVertex<FVec>(LocalMesh, IndexB), Alpha), 
+						FMath::Lerp(FVec(GetWaterInfo(IndexA).WaterVelocity), FVec(GetWaterInfo(IndexB).WaterVelocity), Alpha),
+						0.f
+					};
+				};
+
+				// Clip the triangle against the surface, the winding of the pieces does not matter as the normal is taken from the original triangle
+				FClipVertex PieceVertices[2][3];
+				int32       NumPieces = 1;
+				if (NumUnder == 3)
+				{
+					PieceVertices[0][0] = MakeVertex(Under[0]);
+					PieceVertices[0][1] = MakeVertex(Under[1]);
+					PieceVertices[0][2] = MakeVertex(Under[2]);
+				}
+				else if (NumUnder == 1)
+				{
+					PieceVertices[0][0] = MakeVertex(Under[0]);
+					PieceVertices[0][1] = MakeSplitVertex(Under[0], Over[0]);
+					PieceVertices[0][2] = MakeSplitVertex(Under[0], Over[1]);
+				}
+				else
+				{
+					const FClipVertex AB = MakeSplitVertex(Over[0], Under[0]);
+					const FClipVertex AC = MakeSplitVertex(Over[0], Under[1]);
+					PieceVertices[0][0] = AB;
+					PieceVertices[0][1] = MakeVertex(Under[0]);
+					PieceVertices[0][2] = MakeVertex(Under[1]);
+					PieceVertices[1][0] = AB;
+					PieceVertices[1][1] = AC;
+					PieceVertices[1][2] = PieceVertices[0][2];
+					NumPieces = 2;
+				}
+
+				// Submerged triangle might be too small for accurate calculation, use OriginalTriangleVertices
+				const FVec Normal = FVec::CrossProduct(OriginalTriangleVertices[1] - OriginalTriangleVertices[0], OriginalTriangleVertices[2] - OriginalTriangleVertices[0]).GetSafeNormal();
+
+				FPiece Pieces[2];
+				float  SweptWaterArea = 0.f;
+				for (int32 p = 0; p < NumPieces; ++p)
+				{
+					const FClipVertex (&V)[3] = PieceVertices[p];
+					const FVec Vertices[3] = { V[0].Position, V[1].Position, V[2].Position };
+
+					FPiece& Piece = Pieces[p];
+					Piece.Centroid = CalcTriangleElemAvg(Vertices);
+					Piece.Area     = FMath::Max(CalcTriangleAreaM2(Vertices), 0.001f);
+					Piece.Velocity = (LinearVelocity + FVec::CrossProduct(AngularVelocity, Piece.Centroid - CenterOfMass)) * 0.01f /* cm/s -> m/s */
+						- (V[0].WaterVelocity + V[1].WaterVelocity + V[2].WaterVelocity) * (0.01f /* cm/s -> m/s */ / 3.f);
+
+					const float VelocitySizeSquared = Piece.Velocity.SizeSquared();
+					const float VelocityInvSqrtSize = VelocitySizeSquared > SMALL_NUMBER ? FMath::InvSqrt(VelocitySizeSquared) : 0.f;
+					Piece.VelocitySize              = VelocitySizeSquared * VelocityInvSqrtSize;
+					Piece.VelocityNormalDot         = FVec::DotProduct(Piece.Velocity * VelocityInvSqrtSize, Normal);
+
+					Sums.FluidVelocity   -= Piece.Velocity;
+					Sums.SubmergedArea   += Piece.Area;
+					Sums.SubmergedBounds += FVector3f(V[0].Position);
+					Sums.SubmergedBounds += FVector3f(V[1].Position);
+					Sums.SubmergedBounds += FVector3f(V[2].Position);
+
+					// NOTE: We do not multiply with 100 (N -> cN) since Gravity is supplied in cm/s instead of m/s
+					if (Settings.bEnableBuoyancyForce && !bVolumeBuoyancy)
+					{
+						const float AvgDepth = (V[0].Depth + V[1].Depth + V[2].Depth) * (0.01f /* cm -> m */ / 3.f);
+						Sums.BuoyancyForce.AddForce(GravityAcceleration * AvgDepth * Piece.Area * Settings.FluidDensity * Normal, Piece.Centroid, CenterOfMass);
+					}
+
+					if (Settings.bEnableViscousFluidResistance)
+					{
+						const FVec TangentalVelocityNormal = VelocityInvSqrtSize * FVec::VectorPlaneProject(Piece.Velocity, Normal);
+						Sums.ResistanceForce.AddForce(Piece.Area * -TangentalVelocityNormal * VelocitySizeSquared, Piece.Centroid, CenterOfMass);
+					}
+
+					if (Settings.bEnablePressureDragForce)
+					{
+						const float ReferenceVelocityRatio = Piece.VelocitySize * InvDragRefSpeed;
+						const bool  bPressure              = Piece.VelocityNormalDot > 0.f;
+						const float C1                     = bPressure ? Settings.PressureCoefficientOfLinearSpeed      : Settings.SuctionCoefficientOfLinearSpeed;
+						const float C2                     = bPressure ? Settings.PressureCoefficientOfExponentialSpeed : Settings.SuctionCoefficientOfExponentialSpeed;
+						const float F                      = bPressure ? Settings.PressureAngularDependence             : Settings.SuctionAngularDependence;
+						const float Dir                    = bPressure ? -1.f : 1.f;
+						Sums.PressureDragForce.AddForce(Dir * (C1 * ReferenceVelocityRatio + C2 * ReferenceVelocityRatio * ReferenceVelocityRatio) 
+							* Piece.Area * FMath::Pow(FMath::Abs(Piece.VelocityNormalDot), F) * Normal * 100.f /* N -> cN */, Piece.Centroid, CenterOfMass);
+					}
+
+					if (Piece.VelocityNormalDot > 0.f)
+						SweptWaterArea += Piece.Area * Piece.VelocitySize;
+				}
+
+				if (Settings.bEnableSlammingForce)
+				{
+					CurrentFrame[TriangleIndex].SweptWaterArea = SweptWaterArea;
+					const float PrevSweptWaterArea = PreviousFrame[TriangleIndex].SweptWaterArea;
+
+					for (int32 p = 0; p < NumPieces; ++p)
+					{
+						const FPiece& Piece = Pieces[p];
+						if (Piece.VelocityNormalDot <= 0.f) // Triangle is receding from the water, no stopping force
+							continue;
+
+						const float FlowAcceleration = (SweptWaterArea - PrevSweptWaterArea) / (Piece.Area * DeltaTime);
+						const FVec  StoppingForce    = BodyMass * -Piece.Velocity * (2.f * Piece.Area);
+						Sums.SlammingForce.AddForce(FMath::Clamp(FMath::Pow(FlowAcceleration / Settings.MaxSlammingForceAtAcceleration, Settings.SlammingForceExponent), 0.f, 1.f) 
+							* Piece.VelocityNormalDot * StoppingForce * 100.f /* N -> cN */, Piece.Centroid, CenterOfMass);
+					}
+				}
+			}
+		};
+
+		// The partial sums are reduced in range order, so the result does not depend on which task finishes first
+		const int32 NumRanges = GetNumTriangleRanges(NumTriangles, Settings.ParallelTriangleThreshold);
+
+		TInlineFrameArray<FPartialSums, 16> PartialSums;
+		PartialSums.SetNum(NumRanges);
+		ForEachTriangleRange(NumTriangles, NumRanges, [&](int32 RangeIndex, int32 FirstTriangle, int32 EndTriangle)
+		{
+			IntegrateRange(FirstTriangle, EndTriangle, PartialSums[RangeIndex]);
+		});
+
+		FPartialSums& Sums = PartialSums[0];
+		for (int32 i = 1; i < NumRanges; ++i)
+		{
+			Sums.BuoyancyForce     += PartialSums[i].BuoyancyForce;
+			Sums.ResistanceForce   += PartialSums[i].ResistanceForce;
+			Sums.PressureDragForce += PartialSums[i].PressureDragForce;
+			Sums.SlammingForce     += PartialSums[i].SlammingForce;
+			Sums.FluidVelocity     += PartialSums[i].FluidVelocity;
+			Sums.SubmergedBounds   += PartialSums[i].SubmergedBounds;
+			Sums.SubmergedArea     += PartialSums[i].SubmergedArea;
+			Sums.BodyArea          += PartialSums[i].BodyArea;
+		}
+
+		TotalBuoyancyForce     = ToWorldForce(Sums.BuoyancyForce, LocalToWorld);
+		TotalResistanceForce   = ToWorldForce(Sums.ResistanceForce, LocalToWorld);
+		TotalPressureDragForce = ToWorldForce(Sums.PressureDragForce, LocalToWorld);
+		TotalSlammingForce     = ToWorldForce(Sums.SlammingForce, LocalToWorld);
+		AvgFluidVelocity       = FVector(Sums.FluidVelocity);
+		SubmergedLocalSize     = Sums.SubmergedBounds.bIsValid ? FVector(Sums.SubmergedBounds.GetSize()) : FVector::ZeroVector;
+		TotalSubmergedArea     = Sums.SubmergedArea;
+		TotalBodyArea          = Sums.BodyArea;
+	};
+
+	if (Settings.bBodyRelativePrecision)
+	{
+		// Body space coordinates are small enough for singles, only the body transform needs double precision
+		IntegrateTriangles(FVector3f(LocalCenterOfMass));
+	}
+	else
+	{
+		IntegrateTriangles(LocalCenterOfMass);
+	}
 
-	BodyInstance->AddForce(TotalWaterPhysicsForce.Force, false);
-	BodyInstance->AddTorqueInRadians(TotalWaterPhysicsForce.Torque, false);
+	WaterBody.SubmergedArea = TotalSubmergedArea;
+
+	if (Settings.bEnableBuoyancyForce && bVolumeBuoyancy)
+	{
+		// The pressure integral over a closed, fully submerged mesh is its displaced volume acting at the centroid of that volume
+		const FVector Centroid = LocalToWorld.TransformPositionNoScale(LocalMesh.Centroid);
+		TotalBuoyancyForce.AddForce(-Gravity * Settings.FluidDensity * LocalMesh.Volume * 0.000001f /* cm3 -> m3 */, Centroid, BodyCenterOfMass);
+	}
+
+	if (Settings.bEnableViscousFluidResistance)
+	{
+		// Same friction coefficient as CalculateWaterForces, with the fluid travel length measured across the body space submerged bounds
+		const FVector RelativeVelocity       = AvgFluidVelocity; // Body space
+		const float   RelativeVelocitySize   = RelativeVelocity.Size();
+		const FVector RelativeVelocityNormal = FMath::IsNearlyZero(RelativeVelocitySize) ? FVector::UpVector : RelativeVelocity.GetSafeNormal();
+		const float   FluidTravelLength      = FMath::Max(1.f, (float)FVector::DotProduct(RelativeVelocityNormal.GetAbs(), SubmergedLocalSize)) * 0.01f /* cm -> m */;
+
+		const float Rn          = (RelativeVelocitySize * FluidTravelLength) / (Settings.FluidKinematicViscocity * 0.000001f /* centistokes -> m2/s */);
+		const float Denominator = FMath::LogX(10.f, FMath::Max(5.f, Rn) + 100.f) - 2.f;
+		const float Cf          = 0.075f / (Denominator * Denominator);
+		const float Scale       = 0.5f * Settings.FluidDensity * Cf * 100.f /* N -> cN */;
+
+		TotalResistanceForce.Force  *= Scale;
+		TotalResistanceForce.Torque *= Scale;
+
+		DEBUG_CAPTURE_NUMBER("FluidTravelLength", FluidTravelLength);
+		DEBUG_CAPTURE_NUMBER("Rn", Rn);
+		DEBUG_CAPTURE_NUMBER("Cf", Cf);
+	}
+
+	if (Settings.bEnablePressureDragForce && Settings.bEnableForceClamping)
+		ClampDragForce(TotalPressureDragForce, DeltaTime, BodyMass, BodyInertiaTensor, BodyTransform.GetRotation(), BodyLinearVelocity, BodyAngularVelocity);
+
+	if (Settings.bEnableSlammingForce && TotalBodyArea > 0.f)
+	{
+		TotalSlammingForce.Force  /= TotalBodyArea;
+		TotalSlammingForce.Torque /= TotalBodyArea;
+	}
+
+	EXEC_WITH_WATER_PHYS_DEBUG(
+	{
+		DEBUG_CAPTURE_STRING("BuoyancyForce", TotalBuoyancyForce.Force.ToString());
+		DEBUG_CAPTURE_STRING("ViscousFluidResistanceForce", TotalResistanceForce.Force.ToString());
+		DEBUG_CAPTURE_STRING("PressureDragForce", TotalPressureDragForce.Force.ToString());
+		DEBUG_CAPTURE_STRING("SlammingForce", TotalSlammingForce.Force.ToString());
+
+		UWorld* World = Component->GetWorld();
+		const auto DrawTotal = [World](const FForce& Total, EWaterPhysicsDebugLevel DebugLevel, float Scale)
+		{
+			if (DebugLevel > EWaterPhysicsDebugLevel::None)
+			{
+				EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
+				{
+					DrawDebugLine(World, Total.AvgLocation, Total.AvgLocation + Total.Force / Scale, FColor::Yellow, false, 0.f, -1, 3);
+				});
+			}
+		};
+
+		DrawTotal(TotalBuoyancyForce, Settings.DebugBuoyancyForce, 100.f);
+		DrawTotal(TotalResistanceForce, Settings.DebugViscousFluidResistance, 1000.f);
+		DrawTotal(TotalPressureDragForce, Settings.DebugPressureDragForce, 1000.f);
+		DrawTotal(TotalSlammingForce, Settings.DebugSlammingForce, 1000.f);
+	});
+
+	ActingForces.BuoyancyForce                = TotalBuoyancyForce.Force;
+	ActingForces.BuoyancyTorque               = TotalBuoyancyForce.Torque;
+	ActingForces.ViscousFluidResistanceForce  = TotalResistanceForce.Force;
+	ActingForces.ViscousFluidResistanceTorque = TotalResistanceForce.Torque;
+	ActingForces.PressureDragForce            = TotalPressureDragForce.Force;
+	ActingForces.PressureDragTorque           = TotalPressureDragForce.Torque;
+	ActingForces.SlammingForce                = TotalSlammingForce.Force;
+	ActingForces.SlammingTorque               = TotalSlammingForce.Torque;
+
+	FForce TotalWaterPhysicsForce(ForceInit);
+	TotalWaterPhysicsForce += TotalBuoyancyForce;
+	TotalWaterPhysicsForce += TotalResistanceForce;
+	TotalWaterPhysicsForce += TotalPressureDragForce;
+	TotalWaterPhysicsForce += TotalSlammingForce;
+
+	OutBodyForce.BodyInstance = BodyInstance;
+	OutBodyForce.Force        = TotalWaterPhysicsForce.Force;
+	OutBodyForce.Torque       = TotalWaterPhysicsForce.Torque;
+}
+
+void FWaterPhysicsScene::CalculateAnalyticWaterForces(const UActorComponent* Component, int32 BodyIndex, 
+	const FFetchWaterSurfaceInfoResult& FetchWaterSurfaceInfoResult, float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CalculateAnalyticWaterForces);
+
+	FWaterPhysicsBody& WaterBody    = Bodies[BodyIndex];
+	FActingForces&     ActingForces = BodyActingForces[BodyIndex];
+
+	const FBodyTriangulationResult&    TriangulationResult = *FetchWaterSurfaceInfoResult.BodyTriangulationResult;
+	const FWaterPhysicsCollisionSetup& CollisionSetup      = *TriangulationResult.AnalyticCollisionSetup;
+	const FWaterPhysicsSettings&       Settings            = *FetchWaterSurfaceInfoResult.BodyProcessingResult->WaterPhysicsSettings;
+	FBodyInstance*                     BodyInstance        = FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance->WeldParent 
+															? FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance->WeldParent 
+															: FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyInstance;
+
+	check(IsValid(Component) && BodyInstance);
+
+	SCOPED_OBJECT_DATA_CAPTURE(Component->GetOwner()
+		? *FString::Printf(TEXT("%s.%s"), *Component->GetOwner()->GetName(), *Component->GetName())
+		: *Component->GetName(), TEXT("WaterPhysicsBody"));
+
+	DEBUG_CAPTURE_USTRUCT("Water Physics Settings", Settings);
+
+	// There is no per triangle history while evaluating analytically, make sure we don't use stale data if we fall back to triangles
+	BodyTriangleFrames[BodyIndex].Empty();
+
+	FPlane  WaterPlane(FetchWaterSurfaceInfoResult.VertexWaterInfo[0].WaterSurfaceLocation, FVector::UpVector);
+	FVector WaterVelocity = FVector::ZeroVector;
+	if (!FitWaterPlane(FetchWaterSurfaceInfoResult.VertexWaterInfo, Settings.AnalyticMaxSurfaceDeviation, WaterPlane, WaterVelocity))
+	{
+		// The fitted plane is still our best approximation for this step, use triangles from the next step and onwards
+		WaterBody.bAnalyticFallback = true;
+	}
+
+	// Read for all bodies at once by ReadBodyStates
+	const FBodyState& BodyState           = FetchWaterSurfaceInfoResult.BodyProcessingResult->BodyState;
+	const FVector&    BodyLinearVelocity  = BodyState.LinearVelocity;
+	const FVector&    BodyAngularVelocity = BodyState.AngularVelocity;
+	const FVector&    BodyCenterOfMass    = BodyState.CenterOfMass;
+	const float       BodyMass            = BodyState.Mass;
+	const FVector&    BodyInertiaTensor   = BodyState.InertiaTensor;
+	const FTransform& BodyTransform       = BodyState.Transform;
+
+	FForce TotalBuoyancyForce(ForceInit);
+	FForce TotalResistanceForce(ForceInit);
+	FForce TotalPressureDragForce(ForceInit);
+	float  TotalWettedArea = 0.f;
+
+	// Volume (cm3), surface area (cm2), characteristic length (cm) and projected area (cm2, as a function of flow direction) of each primitive
+	const auto AddPrimitive = [&](const FSubmergedVolume& Submerged, float Volume, float SurfaceArea, float Length, const auto& CalcProjectedArea)
+	{
+		if (Submerged.Volume <= 0.f)
+			return;
+
+		const float SubmergedFraction = FMath::Min(Submerged.Volume / Volume, 1.f);
+
+		// NOTE: We do not multiply with 100 (N -> cN) since Gravity is supplied in cm/s instead of m/s
+		if (Settings.bEnableBuoyancyForce)
+			TotalBuoyancyForce.AddForce(-Gravity * Settings.FluidDensity * Submerged.Volume * 0.000001f /* cm3 -> m3 */, Submerged.Centroid, BodyCenterOfMass);
+
+		const FVector Velocity   = CalcVertexVelocityMS(Submerged.Centroid, BodyCenterOfMass, BodyLinearVelocity, BodyAngularVelocity) - WaterVelocity * 0.01f /* cm/s -> m/s */;
+		const float   Speed      = Velocity.Size();
+		const float   WettedArea = SurfaceArea * SubmergedFraction * 0.0001f /* cm2 -> m2 */;
+		TotalWettedArea += WettedArea;
+
+		if (Speed < UE_KINDA_SMALL_NUMBER)
+			return;
+
+		const FVector VelocityNormal = Velocity / Speed;
+
+		// Same friction model as the triangle path, treating the whole wetted area as tangential to the flow
+		if (Settings.bEnableViscousFluidResistance)
+		{
+			const float Rn          = (Speed * Length * 0.01f /* cm -> m */) / (Settings.FluidKinematicViscocity * 0.000001f /* centistokes -> m2/s */);
+			const float Denominator = FMath::LogX(10.f, FMath::Max(5.f, Rn) + 100.f) - 2.f;
+			const float Cf          = 0.075f / (Denominator * Denominator);
+			TotalResistanceForce.AddForce(0.5f * Settings.FluidDensity * Cf * WettedArea * -VelocityNormal * Speed * Speed * 100.f /* N -> cN */, Submerged.Centroid, BodyCenterOfMass);
+		}
+
+		// Pressure on the front facing side and suction on the back facing side, both acting over the projected area
+		if (Settings.bEnablePressureDragForce)
+		{
+			const float ProjectedArea          = CalcProjectedArea(VelocityNormal) * SubmergedFraction * 0.0001f /* cm2 -> m2 */;
+			const float ReferenceVelocityRatio = Speed / Settings.DragReferenceSpeed;
+			const float DragCoefficient        = (Settings.PressureCoefficientOfLinearSpeed + Settings.SuctionCoefficientOfLinearSpeed) * ReferenceVelocityRatio
+				+ (Settings.PressureCoefficientOfExponentialSpeed + Settings.SuctionCoefficientOfExponentialSpeed) * ReferenceVelocityRatio * ReferenceVelocityRatio;
+			TotalPressureDragForce.AddForce(-DragCoefficient * ProjectedArea * VelocityNormal * 100.f /* N -> cN */, Submerged.Centroid, BodyCenterOfMass);
+		}
+	};
+
+	const FTransform& CollisionTransform = TriangulationResult.BodyTransform;
+
+	for (const FWaterPhysicsCollisionSetup::FSphereElem& SphereElem : CollisionSetup.SphereElems)
+	{
+		const float R = SphereElem.Radius;
+		AddPrimitive(CalcSphereSubmergedVolume(CollisionTransform.TransformPosition(SphereElem.Center), R, WaterPlane),
+			(4.f / 3.f) * PI * R * R * R, 4.f * PI * R * R, 2.f * R,
+			[&](const FVector&) { return PI * R * R; });
+	}
+
+	for (const FWaterPhysicsCollisionSetup::FBoxElem& BoxElem : CollisionSetup.BoxElems)
+	{
+		const FVector& E        = BoxElem.Extent;
+		const FQuat    Rotation = CollisionTransform.GetRotation() * BoxElem.Rotation.Quaternion();
+		AddPrimitive(CalcBoxSubmergedVolume(CollisionTransform.TransformPosition(BoxElem.Center), Rotation, E, WaterPlane),
+			8.f * E.X * E.Y * E.Z, 8.f * (E.X * E.Y + E.Y * E.Z + E.X * E.Z), 2.f * E.Size(),
+			[&](const FVector& Direction)
+			{
+				return 4.f * (FMath::Abs(FVector::DotProduct(Direction, Rotation.GetAxisX())) * E.Y * E.Z
+							+ FMath::Abs(FVector::DotProduct(Direction, Rotation.GetAxisY())) * E.X * E.Z
+							+ FMath::Abs(FVector::DotProduct(Direction, Rotation.GetAxisZ())) * E.X * E.Y);
+			});
+	}
+
+	for (const FWaterPhysicsCollisionSetup::FSphylElem& SphylElem : CollisionSetup.SphylElems)
+	{
+		const float   R    = SphylElem.Radius;
+		const float   H    = SphylElem.HalfHeight;
+		const FVector Axis = (CollisionTransform.GetRotation() * SphylElem.Rotation.Quaternion()).GetAxisZ();
+		AddPrimitive(CalcCapsuleSubmergedVolume(CollisionTransform.TransformPosition(SphylElem.Center), Axis, H, R, WaterPlane),
+			PI * R * R * (2.f * H + (4.f / 3.f) * R), 2.f * PI * R * (2.f * H + 2.f * R), 2.f * (H + R),
+			[&](const FVector& Direction)
+			{
+				const float AxisDot = FVector::DotProduct(Direction, Axis);
+				return PI * R * R + 4.f * R * H * FMath::Sqrt(FMath::Max(0.f, 1.f - AxisDot * AxisDot));
+			});
+	}
+
+	if (Settings.bEnablePressureDragForce && Settings.bEnableForceClamping)
+		ClampDragForce(TotalPressureDragForce, DeltaTime, BodyMass, BodyInertiaTensor, BodyTransform.GetRotation(), BodyLinearVelocity, BodyAngularVelocity);
+
+	EXEC_WITH_WATER_PHYS_DEBUG(
+	{
+		DEBUG_CAPTURE_STRING("WaterPlane", WaterPlane.ToString());
+		DEBUG_CAPTURE_STRING("BuoyancyForce", TotalBuoyancyForce.Force.ToString());
+		DEBUG_CAPTURE_STRING("ViscousFluidResistanceForce", TotalResistanceForce.Force.ToString());
+		DEBUG_CAPTURE_STRING("PressureDragForce", TotalPressureDragForce.Force.ToString());
+
+		if (Settings.DebugBuoyancyForce > EWaterPhysicsDebugLevel::None)
+		{
+			UWorld* World = Component->GetWorld();
+			EXEC_WITH_WATER_PHYS_DEBUG_ON_GAME_THREAD([=]()
+			{
+				DrawDebugLine(World, TotalBuoyancyForce.AvgLocation, TotalBuoyancyForce.AvgLocation + TotalBuoyancyForce.Force / 100.f, FColor::Yellow, false, 0.f, -1, 3);
+			});
+		}
+	});
+
+	WaterBody.SubmergedArea = TotalWettedArea;
+
+	ActingForces.BuoyancyForce                = TotalBuoyancyForce.Force;
+	ActingForces.BuoyancyTorque               = TotalBuoyancyForce.Torque;
+	ActingForces.ViscousFluidResistanceForce  = TotalResistanceForce.Force;
+	ActingForces.ViscousFluidResistanceTorque = TotalResistanceForce.Torque;
+	ActingForces.PressureDragForce            = TotalPressureDragForce.Force;
+	ActingForces.PressureDragTorque           = TotalPressureDragForce.Torque;
+	ActingForces.SlammingForce                = FVector::ZeroVector;
+	ActingForces.SlammingTorque               = FVector::ZeroVector;
+
+	FForce TotalWaterPhysicsForce(ForceInit);
+	TotalWaterPhysicsForce += TotalBuoyancyForce;
+	TotalWaterPhysicsForce += TotalResistanceForce;
+	TotalWaterPhysicsForce += TotalPressureDragForce;
+
+	OutBodyForce.BodyInstance = BodyInstance;
+	OutBodyForce.Force        = TotalWaterPhysicsForce.Force;
+	OutBodyForce.Torque       = TotalWaterPhysicsForce.Torque;
 }
 
-void FWaterPhysicsScene::StepWaterBodies_Synchronous(TArray<TPair<const UActorComponent*, FWaterPhysicsBody*>>& WaterBodies, float DeltaTime, const FVector& Gravity, 
+void FWaterPhysicsScene::StepWaterBodies_Synchronous(FWaterBodyList& WaterBodies, float DeltaTime, const FVector& Gravity, 
 	const FWaterPhysicsSettings& SceneSettings, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(StepWaterBodies_Synchronous);
@@ -1454,80 +4187,166 @@ void FWaterPhysicsScene::StepWaterBodies_Synchronous(TArray<TPair<const UActorCo
 	// This function splits the workload up in segments which can be run in parallel and in to those which has to be run on the GameThread.
 	// Right now the only part which has to run on the game thread is the surface information fetching as we cannot know what it does in the SurfaceGetter.
 
-	// Step 1: ProcessWaterPhysicsBody and TriangulateBody - Parallel
-	TArray<FWaterBodyProcessingResult> WaterBodyProcessingResults;
-	TArray<FBodyTriangulationResult>   BodyTriangulationResult;
+	// Step 1: ProcessWaterPhysicsBody, ReadBodyStates and TriangulateBody - Parallel
+	TFrameArray<FWaterBodyProcessingResult> WaterBodyProcessingResults;
+	TFrameArray<FBodyTriangulationResult>   BodyTriangulationResult;
+	TFrameArray<uint64>                     BodyStepCycles;
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(ProcessBodies);
 
 		WaterBodyProcessingResults.SetNum(WaterBodies.Num());
 		BodyTriangulationResult.SetNum(WaterBodies.Num());
+		BodyStepCycles.SetNumZeroed(WaterBodies.Num());
 
 		ParallelFor(WaterBodies.Num(), [&](int32 Index)
 		{
-			WaterBodyProcessingResults[Index] = ProcessWaterPhysicsBody(WaterBodies[Index].Key, *WaterBodies[Index].Value, SceneSettings);
-			BodyTriangulationResult[Index] = TriangulateBody(WaterBodies[Index].Key, *WaterBodies[Index].Value, WaterBodyProcessingResults[Index]);
+			FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+			WaterBodyProcessingResults[Index] = ProcessWaterPhysicsBody(BodyComponents[WaterBodies[Index]], WaterBodies[Index], SceneSettings);
 		});
 
+		ReadBodyStates(WaterBodyProcessingResults);
+
+		ParallelFor(WaterBodies.Num(), [&](int32 Index)
+		{
+			FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			BodyTriangulationResult[Index] = TriangulateBody(BodyComponents[WaterBodies[Index]], WaterBodies[Index], WaterBodyProcessingResults[Index]);
+			BodyStepCycles[Index] = FPlatformTime::Cycles64() - StartCycles;
+		}, EParallelForFlags::Unbalanced);
+
 		// Minor optimization, don't continue with bodies which don't have any triangulation
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(ClearInvalidResults);
 
+			// Compact in a single stable pass to keep the bodies in their cost-sorted order
+			int32 NumValid = 0;
 			for (int32 i = 0; i < BodyTriangulationResult.Num(); i++)
 			{
-				if (BodyTriangulationResult[i].TriangulatedBody.IndexList.Num() == 0)
+				if (BodyTriangulationResult[i].IsEmpty())
 				{
-					BodyTriangulationResult.RemoveAtSwap(i, 1, EAllowShrinking::No);
-					WaterBodies.RemoveAtSwap(i, 1, EAllowShrinking::No);
-					i--;
+					Bodies[WaterBodies[i]].UpdateStepCost(BodyStepCycles[i]);
+					continue;
 				}
+
+				if (NumValid != i)
+				{
+					BodyTriangulationResult[NumValid] = MoveTemp(BodyTriangulationResult[i]);
+					BodyStepCycles[NumValid]          = BodyStepCycles[i];
+					WaterBodies[NumValid]             = WaterBodies[i];
+				}
+				NumValid++;
 			}
+
+			BodyTriangulationResult.SetNum(NumValid, EAllowShrinking::No);
+			BodyStepCycles.SetNum(NumValid, EAllowShrinking::No);
+			WaterBodies.SetNum(NumValid, EAllowShrinking::No);
 		}
 	}
 
 	// Step 2: FetchWaterSurfaceInfo - Synchronous
-	TArray<FFetchWaterSurfaceInfoResult> WaterSurfaceIntersectionResults;
+	TFrameArray<FFetchWaterSurfaceInfoResult> WaterSurfaceIntersectionResults;
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FetchWaterSurfaceInfo);
 
 		WaterSurfaceIntersectionResults.SetNum(BodyTriangulationResult.Num());
 		for (int32 Index = 0; Index < BodyTriangulationResult.Num(); ++Index)
 		{
-			WaterSurfaceIntersectionResults[Index] = FetchWaterSurfaceInfo(WaterBodies[Index].Key, *WaterBodies[Index].Value, BodyTriangulationResult[Index], 
-				WaterBodyProcessingResults[Index].WaterPhysicsSettings.WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
+			WaterSurfaceIntersectionResults[Index] = FetchWaterSurfaceInfo(BodyComponents[WaterBodies[Index]], Bodies[WaterBodies[Index]], BodyTriangulationResult[Index], 
+				SurfaceGetter, WaterSurfaceProvider);
 		}
 	}
 
-	// Step 3: BodyWaterIntersection and CalculateWaterForces - Parallel
+	// Step 3: BodyWaterIntersection - Parallel
+	TFrameArray<FBodyWaterIntersectionResult> BodyWaterIntersectionResults;
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(CalculateWaterForces);
+		TRACE_CPUPROFILER_EVENT_SCOPE(BodyWaterIntersection);
 
+		BodyWaterIntersectionResults.SetNum(WaterSurfaceIntersectionResults.Num());
 		ParallelFor(WaterSurfaceIntersectionResults.Num(), [&](int32 Index)
 		{
-			const auto BodyWaterIntersectionResult = BodyWaterIntersection(WaterSurfaceIntersectionResults[Index]);
-			CalculateWaterForces(WaterBodies[Index].Key, *WaterBodies[Index].Value, BodyWaterIntersectionResult, DeltaTime, Gravity);
-		});
+			FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			BodyWaterIntersectionResults[Index] = BodyWaterIntersection(WaterSurfaceIntersectionResults[Index]);
+			BodyStepCycles[Index] += FPlatformTime::Cycles64() - StartCycles;
+		}, EParallelForFlags::Unbalanced);
+	}
+
+	// Step 4: SampleSubmergedTessellation - Synchronous
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(SampleSubmergedTessellation);
+
+		for (int32 Index = 0; Index < BodyWaterIntersectionResults.Num(); ++Index)
+			SampleSubmergedTessellation(BodyComponents[WaterBodies[Index]], BodyWaterIntersectionResults[Index], SurfaceGetter, WaterSurfaceProvider);
+	}
+
+	// Step 5: CalculateWaterForces - Parallel
+	TFrameArray<FBodyForceOutput> BodyForces;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CalculateWaterForces);
+
+		BodyForces.SetNum(BodyWaterIntersectionResults.Num());
+		ParallelFor(BodyWaterIntersectionResults.Num(), [&](int32 Index)
+		{
+			FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			CalculateWaterForces(BodyComponents[WaterBodies[Index]], WaterBodies[Index], BodyWaterIntersectionResults[Index], DeltaTime, Gravity, BodyForces[Index]);
+			Bodies[WaterBodies[Index]].UpdateStepCost(BodyStepCycles[Index] + FPlatformTime::Cycles64() - StartCycles);
+		}, EParallelForFlags::Unbalanced);
 	}
+
+	// Step 6: ApplyBodyForces - Synchronous
+	ApplyBodyForces(BodyForces);
 }
 
-void FWaterPhysicsScene::StepWaterBodies_Parallel(TArray<TPair<const UActorComponent*, FWaterPhysicsBody*>>& WaterBodies, float DeltaTime, const FVector& Gravity, 
+void FWaterPhysicsScene::StepWaterBodies_Parallel(FWaterBodyList& WaterBodies, float DeltaTime, const FVector& Gravity, 
 	const FWaterPhysicsSettings& SceneSettings, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(StepWaterBodies_Parallel);
 
+	// The state of all bodies is read under a single lock, the body tasks only read from the processing results
+	TFrameArray<FWaterBodyProcessingResult> WaterBodyProcessingResults;
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ProcessBodies);
+
+		WaterBodyProcessingResults.SetNum(WaterBodies.Num());
+		ParallelFor(WaterBodies.Num(), [&](int32 Index)
+		{
+			FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+			FTaskTagScope ParallelGameThreadScope(ETaskTag::EParallelGameThread);
+			WaterBodyProcessingResults[Index] = ProcessWaterPhysicsBody(BodyComponents[WaterBodies[Index]], WaterBodies[Index], SceneSettings);
+		});
+
+		ReadBodyStates(WaterBodyProcessingResults);
+	}
+
+	TFrameArray<FBodyForceOutput> BodyForces;
+	BodyForces.SetNum(WaterBodies.Num());
+
+	// Each body is picked up on its own by the next free worker, together with the sorting by cost this schedules the largest bodies first
 	ParallelFor(WaterBodies.Num(), [&](int32 Index)
 	{
-		DYNAMIC_CPUPROFILER_EVENT_SCOPE(StepWaterBody, "_%s.%s", *WaterBodies[Index].Key->GetName(), *WaterBodies[Index].Value->BodyName.ToString());
+		FWaterPhysicsFrameArena::FScope FrameArenaScope(&FrameArena);
+		const int32            BodyIndex = WaterBodies[Index];
+		const UActorComponent* Component = BodyComponents[BodyIndex];
+		FWaterPhysicsBody&     WaterBody = Bodies[BodyIndex];
+
+		DYNAMIC_CPUPROFILER_EVENT_SCOPE(StepWaterBody, "_%s.%s", *Component->GetName(), *BodyNames[BodyIndex].ToString());
 
 		FTaskTagScope ParallelGameThreadScope(ETaskTag::EParallelGameThread);
 
-		const auto WaterBodyProcessingResult = ProcessWaterPhysicsBody(WaterBodies[Index].Key, *WaterBodies[Index].Value, SceneSettings);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		ON_SCOPE_EXIT { WaterBody.UpdateStepCost(FPlatformTime::Cycles64() - StartCycles); };
+
+		const FWaterBodyProcessingResult& WaterBodyProcessingResult = WaterBodyProcessingResults[Index];
 		if (WaterBodyProcessingResult.BodyInstance == nullptr)
 			return;
 
-		const auto BodyTriangulationResult        = TriangulateBody(WaterBodies[Index].Key, *WaterBodies[Index].Value, WaterBodyProcessingResult);
-		const auto WaterSurfaceIntersectionResult = FetchWaterSurfaceInfo(WaterBodies[Index].Key, *WaterBodies[Index].Value, BodyTriangulationResult, WaterBodyProcessingResult.WaterPhysicsSettings.WaterInfoFetchingMethod, SurfaceGetter, WaterSurfaceProvider);
-		const auto BodyWaterIntersectionResult    = BodyWaterIntersection(WaterSurfaceIntersectionResult);
-		CalculateWaterForces(WaterBodies[Index].Key, *WaterBodies[Index].Value, BodyWaterIntersectionResult, DeltaTime, Gravity);
-	});
+		const auto BodyTriangulationResult        = TriangulateBody(Component, BodyIndex, WaterBodyProcessingResult);
+		const auto WaterSurfaceIntersectionResult = FetchWaterSurfaceInfo(Component, WaterBody, BodyTriangulationResult, SurfaceGetter, WaterSurfaceProvider);
+		auto       BodyWaterIntersectionResult    = BodyWaterIntersection(WaterSurfaceIntersectionResult);
+		SampleSubmergedTessellation(Component, BodyWaterIntersectionResult, SurfaceGetter, WaterSurfaceProvider);
+		CalculateWaterForces(Component, BodyIndex, BodyWaterIntersectionResult, DeltaTime, Gravity, BodyForces[Index]);
+	}, EParallelForFlags::Unbalanced);
+
+	ApplyBodyForces(BodyForces);
 }
@@ -8,6 +8,38 @@
 #include "GameFramework/WorldSettings.h"
 #include "WorldAlignedWaterSurfaceProvider.h"
 #include "Components/PrimitiveComponent.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "UObject/UObjectGlobals.h"
+
+DECLARE_STATS_GROUP(TEXT("WaterPhysics"), STATGROUP_WaterPhysics, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pruned Body Names"), STAT_WaterPhysicsPrunedBodyNames, STATGROUP_WaterPhysics);
+
+namespace WaterPhysicsSceneComponent
+{
+	// Socket names of the component which resolve to a body instance, each body instance only once. NAME_None is resolved first so that it
+	// is kept for the root body, e.g. every socket of a static mesh resolves to the same body instance.
+	TArray<FName> GetPhysicsBodyNames(const UPrimitiveComponent* PrimitiveComponent, int32& OutNumPruned)
+	{
+		TArray<FName> SocketNames = PrimitiveComponent->GetAllSocketNames();
+		SocketNames.Remove(NAME_None);
+		SocketNames.Insert(NAME_None, 0);
+
+		TArray<FName> BodyNames;
+		TArray<const FBodyInstance*, TInlineAllocator<16>> BodyInstances;
+		for (const FName& SocketName : SocketNames)
+		{
+			const FBodyInstance* BodyInstance = PrimitiveComponent->GetBodyInstance(SocketName, false);
+			if (BodyInstance && !BodyInstances.Contains(BodyInstance))
+			{
+				BodyInstances.Add(BodyInstance);
+				BodyNames.Add(SocketName);
+			}
+		}
+
+		OutNumPruned = SocketNames.Num() - BodyNames.Num();
+		return BodyNames;
+	}
+}
 
 UWaterPhysicsSceneComponent::UWaterPhysicsSceneComponent()
 {
@@ -32,6 +64,12 @@ void UWaterPhysicsSceneComponent::EndPlay(EEndPlayReason::Type EndPlayReason)
 {
 	WaterPhysicsScene.ClearWaterPhysicsScene();
 
+	PhysicsStateBodyResolves.Reset();
+	UActorComponent::GlobalCreatePhysicsDelegate.Remove(CreatePhysicsStateHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	CreatePhysicsStateHandle.Reset();
+	PostGarbageCollectHandle.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -104,16 +142,35 @@ void UWaterPhysicsSceneComponent::AddComponentToWaterPhysics(UActorComponent* Co
 	TArray<FName> Sockets;
 	if (bAllBodies)
 	{
-		if (Component->Implements<UWaterPhysicsCollisionInterface>())
+		if (bImplementsCollisionInterface)
+		{
 			Sockets = dynamic_cast<IWaterPhysicsCollisionInterface*>(Component)->GetAllBodyNames();
+			Sockets.AddUnique(NAME_None);
+		}
 		else
-			Sockets = PrimitiveComponent->GetAllSocketNames();
-
-		Sockets.AddUnique(NAME_None);
+		{
+			// Which sockets have a body is only known from the physics state, which may not be created yet or be recreated with other bodies later
+			const FPhysicsStateBodyResolve& BodyResolve = PhysicsStateBodyResolves.Add(FObjectKey(Component), FPhysicsStateBodyResolve{ WaterPhysicsSettings });
+			if (!CreatePhysicsStateHandle.IsValid())
+			{
+				CreatePhysicsStateHandle = UActorComponent::GlobalCreatePhysicsDelegate.AddUObject(this, &UWaterPhysicsSceneComponent::OnComponentCreatePhysicsState);
+				PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UWaterPhysicsSceneComponent::OnPostGarbageCollect);
+			}
+
+			if (PrimitiveComponent->IsPhysicsStateCreated())
+				ResolveComponentBodies(PrimitiveComponent, BodyResolve, true);
+			return;
+		}
 	}
 	else
+	{
 		Sockets.Add(BodyName);
 
+		// Explicitly added back after it was removed on its own
+		if (FPhysicsStateBodyResolve* BodyResolve = PhysicsStateBodyResolves.Find(FObjectKey(Component)))
+			BodyResolve->RemovedBodyNames.Remove(BodyName);
+	}
+
 	for (const FName& SocketName : Sockets)
 		WaterPhysicsScene.AddComponentBody(Component, SocketName, WaterPhysicsSettings);
 }
@@ -121,9 +178,17 @@ void UWaterPhysicsSceneComponent::AddComponentToWaterPhysics(UActorComponent* Co
 bool UWaterPhysicsSceneComponent::RemoveComponentFromWaterPhysics(UActorComponent* Component, bool bAllBodies, FName BodyName)
 {
 	if (bAllBodies)
-		return WaterPhysicsScene.RemoveComponent(Component);
+	{
+		const bool bWasPending = PhysicsStateBodyResolves.Remove(FObjectKey(Component)) != 0;
+		return WaterPhysicsScene.RemoveComponent(Component) || bWasPending;
+	}
 	else
+	{
+		if (FPhysicsStateBodyResolve* BodyResolve = PhysicsStateBodyResolves.Find(FObjectKey(Component)))
+			BodyResolve->RemovedBodyNames.AddUnique(BodyName);
+
 		return WaterPhysicsScene.RemoveComponentBody(Component, BodyName);
+	}
 }
 
 void UWaterPhysicsSceneComponent::SetComponentWaterPhysicsSettings(UActorComponent* Component, const FWaterPhysicsSettings& WaterPhysicsSettings, bool bAllBodies, FName BodyName)
@@ -136,56 +201,61 @@ void UWaterPhysicsSceneComponent::SetComponentWaterPhysicsSettings(UActorCompone
 
 	if (bAllBodies)
 	{
-		auto* Bodies = WaterPhysicsScene.FindComponentBodies(Component);
-		if (!Bodies)
+		// Used for the bodies resolved when the physics state is next created
+		FPhysicsStateBodyResolve* BodyResolve = PhysicsStateBodyResolves.Find(FObjectKey(Component));
+		if (BodyResolve)
+			BodyResolve->Settings = WaterPhysicsSettings;
+
+		const TConstArrayView<FWaterPhysicsScene::FWaterPhysicsBodyHandle> Bodies = WaterPhysicsScene.FindComponentBodies(Component);
+		if (Bodies.Num() == 0)
 		{
+			if (BodyResolve) // Still waiting for its physics state
+				return;
+
 			UE_LOG(LogWaterPhysics, Error, TEXT("%s.SetPrimitiveWaterPhysicsSettings No Valid Water Physics for Component %s"), *GetName(), *Component->GetName());
 			return;
 		}
 
-		for (auto& Body : *Bodies)
-			Body.WaterPhysicsSettings = WaterPhysicsSettings;
+		for (const FWaterPhysicsScene::FWaterPhysicsBodyHandle& Body : Bodies)
+			WaterPhysicsScene.SetBodyWaterPhysicsSettings(Body, WaterPhysicsSettings);
 	}
 	else
 	{
-		auto* Body = WaterPhysicsScene.FindComponentBody(Component, BodyName);
-		if (!Body)
+		const FWaterPhysicsScene::FWaterPhysicsBodyHandle Body = WaterPhysicsScene.FindComponentBody(Component, BodyName);
+		if (!Body.IsValid())
 		{
 			UE_LOG(LogWaterPhysics, Error, TEXT("%s.SetPrimitiveWaterPhysicsSettings No Valid Water Physics for Component body %s.%s"), *GetName(), *Component->GetName(), *BodyName.ToString());
 			return;
 		}
 
-		Body->WaterPhysicsSettings = WaterPhysicsSettings;
+		WaterPhysicsScene.SetBodyWaterPhysicsSettings(Body, WaterPhysicsSettings);
 	}
 }
 
 bool UWaterPhysicsSceneComponent::ContainsComponent(UActorComponent* Component) const
 {
-	return WaterPhysicsScene.ContainsComponent(Component);
+	return WaterPhysicsScene.ContainsComponent(Component) || PhysicsStateBodyResolves.Contains(FObjectKey(Component));
 }
 
 bool UWaterPhysicsSceneComponent::ContainsComponentBody(UActorComponent* Component, FName BodyName) const
 {
-	return WaterPhysicsScene.FindComponentBody(Component, BodyName) != nullptr;
+	return WaterPhysicsScene.FindComponentBody(Component, BodyName).IsValid();
 }
 
 FWaterPhysicsActingForces UWaterPhysicsSceneComponent::GetComponentActingWaterPhysicsForces(UActorComponent* Component) const
 {
 	FWaterPhysicsActingForces OutActingForces;
 
-	if (const TArray<FWaterPhysicsScene::FWaterPhysicsBody>* WaterPhysicsBodies = WaterPhysicsScene.FindComponentBodies(Component))
-	{
-		for (const FWaterPhysicsScene::FWaterPhysicsBody& WaterPhysicsBody : *WaterPhysicsBodies)
-			OutActingForces += FWaterPhysicsActingForces(WaterPhysicsBody.ActingForces);
-	}
+	for (const FWaterPhysicsScene::FWaterPhysicsBodyHandle& Body : WaterPhysicsScene.FindComponentBodies(Component))
+		OutActingForces += FWaterPhysicsActingForces(*WaterPhysicsScene.GetBodyActingForces(Body));
 
 	return OutActingForces;
 }
 
 FWaterPhysicsActingForces UWaterPhysicsSceneComponent::GetComponentBodyActingWaterPhysicsForces(UActorComponent* Component, FName BodyName) const
 {
-	if (const FWaterPhysicsScene::FWaterPhysicsBody* WaterPhysicsBody = WaterPhysicsScene.FindComponentBody(Component, BodyName))
-		return FWaterPhysicsActingForces(WaterPhysicsBody->ActingForces);
+	if (const FWaterPhysicsScene::FActingForces* ActingForces = WaterPhysicsScene.GetBodyActingForces(WaterPhysicsScene.FindComponentBody(Component, BodyName)))
+		return FWaterPhysicsActingForces(*ActingForces);
 
 	return FWaterPhysicsActingForces();
 }
@@ -194,18 +264,15 @@ float UWaterPhysicsSceneComponent::GetComponentSubmergedArea(UActorComponent* Co
 {
 	float OutSubmergedArea = 0.f;
 
-	if (const TArray<FWaterPhysicsScene::FWaterPhysicsBody>* WaterPhysicsBodies = WaterPhysicsScene.FindComponentBodies(Component))
-	{
-		for (const FWaterPhysicsScene::FWaterPhysicsBody& WaterPhysicsBody : *WaterPhysicsBodies)
-			OutSubmergedArea += WaterPhysicsBody.SubmergedArea;
-	}
+	for (const FWaterPhysicsScene::FWaterPhysicsBodyHandle& Body : WaterPhysicsScene.FindComponentBodies(Component))
+		OutSubmergedArea += WaterPhysicsScene.GetBody(Body)->SubmergedArea;
 
 	return OutSubmergedArea;
 }
 
 float UWaterPhysicsSceneComponent::GetComponentBodySubmergedArea(UActorComponent* Component, FName BodyName) const
 {
-	if (const FWaterPhysicsScene::FWaterPhysicsBody* WaterPhysicsBody = WaterPhysicsScene.FindComponentBody(Component, BodyName))
+	if (const FWaterPhysicsScene::FWaterPhysicsBody* WaterPhysicsBody = WaterPhysicsScene.GetBody(WaterPhysicsScene.FindComponentBody(Component, BodyName)))
 		return WaterPhysicsBody->SubmergedArea;
 
 	return 0.f;
@@ -271,4 +338,51 @@ void UWaterPhysicsSceneComponent::StepWaterPhysics(FPhysScene* PhysScene, float
 TSharedPtr<FWaterSurfaceProvider> UWaterPhysicsSceneComponent::MakeWaterSurfaceProvider() const
 {
 	return MakeShared<FWorldAlignedWaterSurfaceProvider>();
+}
+
+void UWaterPhysicsSceneComponent::ResolveComponentBodies(UPrimitiveComponent* PrimitiveComponent, const FPhysicsStateBodyResolve& BodyResolve, bool bResetExistingBodies)
+{
+	// Most sockets of a skeletal mesh have no body, they would be looked up every step only to be skipped
+	int32 NumPruned = 0;
+	const TArray<FName> BodyNames = WaterPhysicsSceneComponent::GetPhysicsBodyNames(PrimitiveComponent, NumPruned);
+	INC_DWORD_STAT_BY(STAT_WaterPhysicsPrunedBodyNames, NumPruned);
+
+	// Remove the bodies the physics state no longer has
+	TArray<FWaterPhysicsScene::FWaterPhysicsBodyHandle, TInlineAllocator<16>> RemovedBodies;
+	for (const FWaterPhysicsScene::FWaterPhysicsBodyHandle& Body : WaterPhysicsScene.FindComponentBodies(PrimitiveComponent))
+	{
+		if (!BodyNames.Contains(WaterPhysicsScene.GetBodyName(Body)))
+			RemovedBodies.Add(Body);
+	}
+
+	for (const FWaterPhysicsScene::FWaterPhysicsBodyHandle& Body : RemovedBodies)
+		WaterPhysicsScene.RemoveBody(Body);
+
+	for (const FName& BodyName : BodyNames)
+	{
+		if (BodyResolve.RemovedBodyNames.Contains(BodyName))
+			continue;
+
+		if (bResetExistingBodies || !WaterPhysicsScene.FindComponentBody(PrimitiveComponent, BodyName).IsValid())
+			WaterPhysicsScene.AddComponentBody(PrimitiveComponent, BodyName, BodyResolve.Settings);
+	}
+}
+
+void UWaterPhysicsSceneComponent::OnComponentCreatePhysicsState(UActorComponent* Component)
+{
+	if (const FPhysicsStateBodyResolve* BodyResolve = PhysicsStateBodyResolves.Find(FObjectKey(Component)))
+	{
+		if (UPrimitiveComponent* PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+			ResolveComponentBodies(PrimitiveComponent, *BodyResolve, false);
+	}
+}
+
+void UWaterPhysicsSceneComponent::OnPostGarbageCollect()
+{
+	// Components destroyed before their physics state was created never get their physics state destroyed either
+	for (auto It = PhysicsStateBodyResolves.CreateIterator(); It; ++It)
+	{
+		if (It.Key().ResolveObjectPtr() == nullptr)
+			It.RemoveCurrent();
+	}
 }
\ No newline at end of file
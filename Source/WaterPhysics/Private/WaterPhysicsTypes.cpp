@@ -1,77 +1,93 @@
 // Copyright Mans Isaksson. All Rights Reserved.
 
 #include "WaterPhysicsTypes.h"
+#include "Algo/Find.h"
+
+// Every setting of FWaterPhysicsSettings which has a bOverride_ toggle. MergeWaterPhysicsSettings is generated from this list, 
+// new settings must be added here as well, which CheckMergedSettings verifies against the reflected struct on startup.
+#define WATER_PHYSICS_OVERRIDABLE_SETTINGS(Setting) \
+	Setting(FluidDensity) \
+	Setting(FluidKinematicViscocity) \
+	Setting(WaterInfoFetchingMethod) \
+	Setting(EvaluationMode) \
+	Setting(AnalyticMaxSurfaceDeviation) \
+	Setting(bBodyRelativePrecision) \
+	Setting(ParallelTriangleThreshold) \
+	Setting(SubdivisionSettings) \
+	Setting(SubmergedTessellationSettings) \
+	Setting(PressureCoefficientOfLinearSpeed) \
+	Setting(PressureCoefficientOfExponentialSpeed) \
+	Setting(PressureAngularDependence) \
+	Setting(SuctionCoefficientOfLinearSpeed) \
+	Setting(SuctionCoefficientOfExponentialSpeed) \
+	Setting(SuctionAngularDependence) \
+	Setting(DragReferenceSpeed) \
+	Setting(MaxSlammingForceAtAcceleration) \
+	Setting(SlammingForceExponent) \
+	Setting(bEnableBuoyancyForce) \
+	Setting(bEnableViscousFluidResistance) \
+	Setting(bEnablePressureDragForce) \
+	Setting(bEnableSlammingForce) \
+	Setting(bEnableForceClamping) \
+	Setting(DebugSubmersion) \
+	Setting(DebugTriangleData) \
+	Setting(DebugBuoyancyForce) \
+	Setting(DebugViscousFluidResistance) \
+	Setting(DebugPressureDragForce) \
+	Setting(DebugSlammingForce) \
+	Setting(DebugFluidVelocity)
+
+#define CHECK_OVERRIDABLE_SETTING(Name) \
+	static_assert(std::is_same_v<decltype(FWaterPhysicsSettings::bOverride_##Name), uint8>, "bOverride_" #Name " must be a uint8 bitfield"); \
+	static_assert(std::is_copy_assignable_v<decltype(FWaterPhysicsSettings::Name)>, #Name " must be copy assignable");
+
+WATER_PHYSICS_OVERRIDABLE_SETTINGS(CHECK_OVERRIDABLE_SETTING)
+
+#undef CHECK_OVERRIDABLE_SETTING
 
 FWaterPhysicsSettings FWaterPhysicsSettings::MergeWaterPhysicsSettings(const FWaterPhysicsSettings& DefaultSettings, const FWaterPhysicsSettings& OverrideSettings)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(MergeWaterPhysicsSettings)
-
 	FWaterPhysicsSettings OutSettings;
 
-	struct FPropertyMemberAddr
-	{
-		FBoolProperty* OverrideBoolProperty;
-		FProperty* Property;
-	};
-	static TArray<FPropertyMemberAddr, TInlineAllocator<32>> OverrideAndPropertyMemberValueAddr;
-	static bool bAreValueAddrInitialized = false;
-	static FCriticalSection CriticalSection;
-
-	if (!bAreValueAddrInitialized)
-	{
-		FScopeLock Lock(&CriticalSection);
-		if (!bAreValueAddrInitialized)
-		{
-			// Save property pointer locations on first merge for major performance improvements
-			if (OverrideAndPropertyMemberValueAddr.Num() == 0)
-			{
-				TMap<FName, FProperty*> OverrideProperties;
-				OverrideProperties.Reserve(64);
-				for (FProperty* Property = FWaterPhysicsSettings::StaticStruct()->PropertyLink; Property; Property = Property->PropertyLinkNext)
-				{
-					const FString PropertyName = Property->GetName();
-					if (PropertyName.StartsWith("bOverride_"))
-					{
-						OverrideProperties.Add(*PropertyName, Property);
-					}
-					else if (FProperty** OverrideProperty = OverrideProperties.Find(*FString::Printf(TEXT("bOverride_%s"), *PropertyName)))
-					{
-						OverrideAndPropertyMemberValueAddr.Add(FPropertyMemberAddr { CastFieldChecked<FBoolProperty>(*OverrideProperty), Property });
-					}
-				}
-			}
-
-			bAreValueAddrInitialized = true;
-		}
+	// Settings which are overridden by neither keep their default value and leave bOverride_ cleared
+#define MERGE_OVERRIDABLE_SETTING(Name) \
+	if (OverrideSettings.bOverride_##Name) \
+	{ \
+		OutSettings.bOverride_##Name = 1; \
+		OutSettings.Name = OverrideSettings.Name; \
+	} \
+	else if (DefaultSettings.bOverride_##Name) \
+	{ \
+		OutSettings.bOverride_##Name = 1; \
+		OutSettings.Name = DefaultSettings.Name; \
 	}
 
-	for (const FPropertyMemberAddr& It : OverrideAndPropertyMemberValueAddr)
-	{
-		if (It.OverrideBoolProperty->GetPropertyValue(It.OverrideBoolProperty->ContainerPtrToValuePtr<void>(&OverrideSettings))) // Is bOverride_ set in OverrideSettings
-		{
-			It.OverrideBoolProperty->SetPropertyValue(It.OverrideBoolProperty->ContainerPtrToValuePtr<void>((void*)&OutSettings), true);
-			It.Property->CopyCompleteValue(
-				It.Property->ContainerPtrToValuePtr<void>((void*)&OutSettings), 
-				It.Property->ContainerPtrToValuePtr<void>(&OverrideSettings)
-			);
-		}
-		else if (It.OverrideBoolProperty->GetPropertyValue(It.OverrideBoolProperty->ContainerPtrToValuePtr<void>(&DefaultSettings))) // Is bOverride_ set in DefaultSettings
-		{
-			It.OverrideBoolProperty->SetPropertyValue(It.OverrideBoolProperty->ContainerPtrToValuePtr<void>((void*)&OutSettings), true);
-			It.Property->CopyCompleteValue(
-				It.Property->ContainerPtrToValuePtr<void>((void*)&OutSettings), 
-				It.Property->ContainerPtrToValuePtr<void>(&DefaultSettings)
-			);
-		}
-		else
-		{
-			It.OverrideBoolProperty->ClearValue(It.OverrideBoolProperty->ContainerPtrToValuePtr<void>((void*)&OutSettings)); // Bitfields are initialized to 1, set them to 0 for merging
-		}
-	}
+	WATER_PHYSICS_OVERRIDABLE_SETTINGS(MERGE_OVERRIDABLE_SETTING)
+
+#undef MERGE_OVERRIDABLE_SETTING
 
 	return OutSettings;
 }
 
+void FWaterPhysicsSettings::CheckMergedSettings()
+{
+#if !UE_BUILD_SHIPPING
+#define OVERRIDABLE_SETTING_NAME(Name) TEXT(#Name),
+	static const TCHAR* MergedSettingNames[] = { WATER_PHYSICS_OVERRIDABLE_SETTINGS(OVERRIDABLE_SETTING_NAME) };
+#undef OVERRIDABLE_SETTING_NAME
+
+	for (FProperty* Property = FWaterPhysicsSettings::StaticStruct()->PropertyLink; Property; Property = Property->PropertyLinkNext)
+	{
+		const FString PropertyName = Property->GetName();
+		if (!PropertyName.StartsWith(TEXT("bOverride_")))
+			continue;
+
+		const FString SettingName = PropertyName.RightChop(10);
+		const bool bIsMerged = Algo::FindByPredicate(MergedSettingNames, [&](const TCHAR* Name) { return SettingName == Name; }) != nullptr;
+		ensureMsgf(bIsMerged, TEXT("FWaterPhysicsSettings::%s is missing from WATER_PHYSICS_OVERRIDABLE_SETTINGS and will not be merged"), *SettingName);
+	}
+#endif
+}
 
 TArray<UActorComponent*> FActorComponentsSelection::GetComponents(AActor* SearchActor, const TArray<UClass*>& IncludeComponentClasses, const TArray<UClass*>& ExcludeComponentClasses) const
 {
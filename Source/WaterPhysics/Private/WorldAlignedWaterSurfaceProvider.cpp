@@ -78,12 +78,8 @@ FWaterSurfaceProvider::FVertexWaterInfoArray FWorldAlignedWaterSurfaceProvider::
 	return OutArray;
 }
 
-// NOTE: Inlining this function can more than double performance depending on the system we're running on
-FORCEINLINE FGetWaterInfoResult FWorldAlignedWaterSurfaceProvider::CalculateWaterInfoAtLocation(const FVector &Location, 
-	const UActorComponent* Component, const FGetWaterInfoAtLocation& GetWaterInfoCallable)
+FORCEINLINE FWorldAlignedWaterSurfaceProvider::FWaterInfoSection* FWorldAlignedWaterSurfaceProvider::FindOrAddSection(const FVector& Location)
 {
-	//TRACE_CPUPROFILER_EVENT_SCOPE(CalculateWaterInfoAtLocation);
-
 RedoFindSection:
 
 	FWaterInfoSection* CurrentWaterSection = nullptr;
@@ -145,6 +141,17 @@ RedoFindSection:
 		}
 	}
 
+	return CurrentWaterSection;
+}
+
+// NOTE: Inlining this function can more than double performance depending on the system we're running on
+FORCEINLINE FGetWaterInfoResult FWorldAlignedWaterSurfaceProvider::CalculateWaterInfoAtLocation(const FVector &Location, 
+	const UActorComponent* Component, const FGetWaterInfoAtLocation& GetWaterInfoCallable)
+{
+	//TRACE_CPUPROFILER_EVENT_SCOPE(CalculateWaterInfoAtLocation);
+
+	FWaterInfoSection* CurrentWaterSection = FindOrAddSection(Location);
+
 	{
 		//TRACE_CPUPROFILER_EVENT_SCOPE(CalculateCellInfoAtLocation);
 
@@ -182,4 +189,37 @@ RedoFindSection:
 
 		return OutResult;
 	}
-};
\ No newline at end of file
+};
+
+bool FWorldAlignedWaterSurfaceProvider::GetWaterHeightBounds(const FBox& Bounds, const UActorComponent* Component, const FGetWaterInfoAtLocation& SurfaceGetter, 
+	FFloatInterval& OutHeightBounds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GetWaterHeightBounds);
+
+	const int32 MinX = FMath::FloorToInt(Bounds.Min.X * WaterInfoSection::InverseCellSize());
+	const int32 MinY = FMath::FloorToInt(Bounds.Min.Y * WaterInfoSection::InverseCellSize());
+	const int32 MaxX = FMath::FloorToInt(Bounds.Max.X * WaterInfoSection::InverseCellSize());
+	const int32 MaxY = FMath::FloorToInt(Bounds.Max.Y * WaterInfoSection::InverseCellSize());
+
+	// Large bodies would have to fetch a lot of cells the vertices might never touch
+	if ((MaxX - MinX + 1) * (MaxY - MinY + 1) > MaxHeightBoundsCells())
+		return false;
+
+	// The interpolated surface never leaves the range of the four corners of a cell, and the corners are cached for the vertices to use later
+	OutHeightBounds = FFloatInterval();
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const FVector CellCenter((X + 0.5f) * WaterInfoSection::CellSize(), (Y + 0.5f) * WaterInfoSection::CellSize(), Bounds.GetCenter().Z);
+			const FWaterInfoSection::FWaterInfoCell Cell = FindOrAddSection(CellCenter)->CalculateCellInfoAtLocation(CellCenter, Component, SurfaceGetter);
+
+			OutHeightBounds.Include(Cell.A->Result.WaterSurfaceLocation.Z);
+			OutHeightBounds.Include(Cell.B->Result.WaterSurfaceLocation.Z);
+			OutHeightBounds.Include(Cell.C->Result.WaterSurfaceLocation.Z);
+			OutHeightBounds.Include(Cell.D->Result.WaterSurfaceLocation.Z);
+		}
+	}
+
+	return true;
+}
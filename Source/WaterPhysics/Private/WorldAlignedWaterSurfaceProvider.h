@@ -133,12 +133,19 @@ private:
 
 	FCriticalSection WaterInfoCS;
 
+	// Bodies covering more cells than this are not bounded, see GetWaterHeightBounds
+	static constexpr int32 MaxHeightBoundsCells() { return 16; }
+
+	FWaterInfoSection* FindOrAddSection(const FVector& Location);
+
 public:
 	virtual void DrawDebugProvider(UWorld* World) override;
 	virtual void EndStepScene() override;
 	virtual FVertexWaterInfoArray CalculateVerticesWaterInfo(const WaterPhysics::FVertexList& Vertices, 
 		const UActorComponent* Component, const FGetWaterInfoAtLocation& SurfaceGetter) override;
 	virtual bool SupportsParallelExecution() const override { return true; }
+	virtual bool GetWaterHeightBounds(const FBox& Bounds, const UActorComponent* Component, const FGetWaterInfoAtLocation& SurfaceGetter, 
+		FFloatInterval& OutHeightBounds) override;
 
 	FGetWaterInfoResult CalculateWaterInfoAtLocation(const FVector& Location, const UActorComponent* Component, const FGetWaterInfoAtLocation& GetWaterInfoCallable);
 };
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/CriticalSection.h"
+#include "WaterPhysicsTypes.h"
+
+class UStaticMesh;
+class FStaticMeshRenderData;
+
+/*
+	Process wide cache of triangle meshes extracted from the CPU accessible render data of static meshes.
+
+	Extracting the index and position buffers of a high poly mesh is expensive, this cache makes sure it only happens once per (StaticMesh, LOD).
+	Entries are immutable and reference counted, they are kept alive for as long as anyone holds on to the returned pointer. If the render
+	data of the mesh gets rebuilt (e.g. the asset is re-imported in the editor) the entry is re-extracted on the next lookup.
+*/
+struct WATERPHYSICS_API FStaticMeshWaterPhysicsCache
+{
+	struct FEntry
+	{
+		WaterPhysics::FIndexedTriangleMesh Mesh;
+		const FStaticMeshRenderData*       SourceRenderData = nullptr;
+	};
+	typedef TSharedPtr<const FEntry, ESPMode::ThreadSafe> FEntryPtr;
+
+	// Returns the cached mesh for the StaticMesh LOD, extracting it if needed. Returns nullptr if no mesh data could be extracted.
+	static FEntryPtr FindOrExtract(const UStaticMesh* StaticMesh, int32 LOD);
+
+private:
+	struct FKey
+	{
+		TObjectKey<UStaticMesh> StaticMesh;
+		int32                   LOD;
+
+		FORCEINLINE friend uint32 GetTypeHash(const FKey& O) { return HashCombine(GetTypeHash(O.StaticMesh), ::GetTypeHash(O.LOD)); }
+		FORCEINLINE bool operator==(const FKey& O) const { return StaticMesh == O.StaticMesh && LOD == O.LOD; }
+	};
+
+	static FEntryPtr ExtractMesh(const UStaticMesh* StaticMesh, int32 LOD);
+
+	static TMap<FKey, TWeakPtr<const FEntry, ESPMode::ThreadSafe>> Entries;
+	static FCriticalSection EntriesCS;
+};
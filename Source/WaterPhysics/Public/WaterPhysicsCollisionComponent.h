@@ -3,6 +3,7 @@
 #pragma once
 #include "Components/SceneComponent.h"
 #include "WaterPhysicsCollisionInterface.h"
+#include "StaticMeshWaterPhysicsCache.h"
 #include "WaterPhysicsCollisionComponent.generated.h"
 
 UENUM()
@@ -78,10 +79,21 @@ public:
 	bool bVisibleOnlyWithShowCollision;
 #endif
 
+private:
+
+	// Keeps the shared CPU copy of Mesh alive while this component is in play (Used with collision type Mesh)
+	FStaticMeshWaterPhysicsCache::FEntryPtr CachedMesh;
+
 public:
 
 	UWaterPhysicsCollisionComponent();
 
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Re-acquires the shared CPU copy of Mesh, should be called if Mesh or LOD is changed during play
+	void UpdateCachedMesh();
+
 #if WITH_EDITOR
 	void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent);
 #endif
@@ -91,6 +103,7 @@ public:
 	virtual FWaterPhysicsCollisionSetup GenerateWaterPhysicsCollisionSetup(const FName& BodyName) const override;
 	virtual FBodyInstance* GetWaterPhysicsCollisionBodyInstance(const FName& BodyName, bool bGetWelded) const override;
 	virtual TArray<FName> GetAllBodyNames() const;
+	virtual uint32 GetWaterPhysicsCollisionSetupHash(const FName& BodyName) const override;
 	// ~End WaterPhysicsCollisionInterface
 
 };
\ No newline at end of file
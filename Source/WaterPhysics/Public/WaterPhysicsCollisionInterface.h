@@ -32,4 +32,9 @@ public:
 
 	// Fetch all the physics body names associated with this water physics collision.
 	virtual TArray<FName> GetAllBodyNames() const = 0;
+
+	// Hash of everything that affects the result of GenerateWaterPhysicsCollisionSetup (excluding scale, which is tracked separately).
+	// The water physics scene caches the triangulated collision setup for as long as this value stays the same.
+	// Returning 0 disables caching, causing the collision setup to be re-generated every step.
+	virtual uint32 GetWaterPhysicsCollisionSetupHash(const FName& BodyName) const { return 0; }
 };
\ No newline at end of file
@@ -0,0 +1,177 @@
+// Copyright Mans Isaksson. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+// Linear allocator for temporaries which only live for the duration of a water physics step. Each scene owns its own arena, which
+// hands every thread its own blocks so workers never contend on a lock, and nothing is freed until the scene resets its arena at the 
+// end of its step. Blocks are kept between steps, once they have grown to fit the scene a step no longer touches the heap.
+//
+// Frame allocations go to the arena of the innermost FScope on the calling thread, and to the heap outside of any scope. Tasks
+// launched from a step have to open a scope of their own, see GetCurrent.
+class WATERPHYSICS_API FWaterPhysicsFrameArena
+{
+public:
+	// Makes Arena the target of frame allocations on the calling thread until the end of the scope. Null routes them to the heap.
+	class WATERPHYSICS_API FScope
+	{
+	public:
+		explicit FScope(FWaterPhysicsFrameArena* Arena);
+		~FScope();
+
+	private:
+		FWaterPhysicsFrameArena* PreviousArena;
+	};
+
+	// Arena of the innermost scope on the calling thread, null outside of any scope
+	static FWaterPhysicsFrameArena* GetCurrent();
+
+	// Releases everything allocated from this arena by any thread. Must not be called while a step using the arena is running.
+	void Reset();
+
+	void* Allocate(SIZE_T Size, uint32 Alignment);
+
+	FWaterPhysicsFrameArena();
+	~FWaterPhysicsFrameArena();
+
+	FWaterPhysicsFrameArena(const FWaterPhysicsFrameArena&) = delete;
+	FWaterPhysicsFrameArena& operator=(const FWaterPhysicsFrameArena&) = delete;
+
+private:
+	static constexpr SIZE_T BlockSize() { return 256 * 1024; }
+
+	struct FBlock
+	{
+		uint8* Data;
+		SIZE_T Size;
+	};
+
+	// The blocks of one thread
+	struct FThreadBlocks
+	{
+		uint32         ThreadId;
+		TArray<FBlock> Blocks;
+		int32          CurrentBlock = 0;
+		SIZE_T         BlockOffset  = 0;
+	};
+
+	const uint64                      ArenaId; // Never reused, unlike the address of the arena
+	FCriticalSection                  ThreadBlocksCS;
+	TArray<TUniquePtr<FThreadBlocks>> ThreadBlocks;
+
+	FThreadBlocks& GetThreadBlocks();
+};
+
+// Container allocator backed by the current FWaterPhysicsFrameArena, see TMemStackAllocator. Freeing arena memory is a no-op, it is reclaimed 
+// at the end of the step. Containers allocated outside of any arena scope use the heap instead.
+// Use it as the secondary allocator of TInlineAllocator to keep small containers on the stack.
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TWaterPhysicsFrameAllocator
+{
+public:
+	using SizeType = int32;
+
+	enum { NeedsElementType = true };
+	enum { RequireRangeCheck = true };
+
+	template<typename ElementType>
+	class ForElementType
+	{
+	public:
+		ForElementType()
+			: Data(nullptr)
+			, bHeapAllocation(false)
+		{}
+
+		~ForElementType()
+		{
+			if (bHeapAllocation)
+				FMemory::Free(Data);
+		}
+
+		FORCEINLINE void MoveToEmpty(ForElementType& Other)
+		{
+			checkSlow(this != &Other);
+
+			if (bHeapAllocation)
+				FMemory::Free(Data);
+
+			Data                  = Other.Data;
+			bHeapAllocation       = Other.bHeapAllocation;
+			Other.Data            = nullptr;
+			Other.bHeapAllocation = false;
+		}
+
+		FORCEINLINE ElementType* GetAllocation() const { return Data; }
+
+		void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement)
+		{
+			ElementType* OldData            = Data;
+			const bool   bOldHeapAllocation = bHeapAllocation;
+			if (NewMax)
+			{
+				checkf(NewMax > 0 && NumBytesPerElement > 0, TEXT("Invalid frame arena allocation (%d x %llu)"), NewMax, (uint64)NumBytesPerElement);
+
+				const uint32 ElementAlignment = FMath::Max(Alignment, (uint32)alignof(ElementType));
+				if (FWaterPhysicsFrameArena* Arena = FWaterPhysicsFrameArena::GetCurrent())
+				{
+					Data            = (ElementType*)Arena->Allocate(NewMax * NumBytesPerElement, ElementAlignment);
+					bHeapAllocation = false;
+				}
+				else
+				{
+					Data            = (ElementType*)FMemory::Malloc(NewMax * NumBytesPerElement, ElementAlignment);
+					bHeapAllocation = true;
+				}
+
+				// An old arena allocation is left in the arena
+				if (OldData && CurrentNum)
+					FMemory::Memcpy(Data, OldData, FMath::Min(NewMax, CurrentNum) * NumBytesPerElement);
+			}
+			else
+			{
+				Data            = nullptr;
+				bHeapAllocation = false;
+			}
+
+			if (bOldHeapAllocation)
+				FMemory::Free(OldData);
+		}
+
+		FORCEINLINE SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, true, Alignment);
+		}
+
+		FORCEINLINE SizeType CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, true, Alignment);
+		}
+
+		FORCEINLINE SizeType CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+		{
+			return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, true, Alignment);
+		}
+
+		FORCEINLINE SIZE_T GetAllocatedSize(SizeType CurrentMax, SIZE_T NumBytesPerElement) const { return CurrentMax * NumBytesPerElement; }
+
+		FORCEINLINE bool HasAllocation() const { return !!Data; }
+
+		FORCEINLINE SizeType GetInitialCapacity() const { return 0; }
+
+	private:
+		ElementType* Data;
+		bool         bHeapAllocation;
+	};
+
+	typedef ForElementType<FScriptContainerElement> ForAnyElementType;
+};
+
+namespace WaterPhysics
+{
+	template<typename T>
+	using TFrameArray = TArray<T, TWaterPhysicsFrameAllocator<>>;
+
+	template<typename T, int32 NumInlineElements>
+	using TInlineFrameArray = TArray<T, TInlineAllocator<NumInlineElements, TWaterPhysicsFrameAllocator<>>>;
+};
@@ -74,17 +74,21 @@ FORCEINLINE FVector CalcTriangleVelocityMS(const TVertex Triangle[3], const FVec
 	return CalcTriangleVelocity(Triangle, BodyCenterOfMass, BodyLinearVelocity, BodyAngularVelocity)  * 0.01f /* cm/s -> m/s */;;
 }
 
-struct FForce
+// Force and torque around the center of mass. Accumulated in the space of the body, in either precision.
+template<typename T>
+struct TForce
 {
-	FVector Force;
-	FVector Torque;
+	using FVectorType = UE::Math::TVector<T>;
+
+	FVectorType Force;
+	FVectorType Torque;
 	#if WITH_WATER_PHYS_DEBUG
-	FVector AvgLocation;
+	FVectorType AvgLocation;
 	#endif
 
-	explicit FORCEINLINE FForce(EForceInit) { FMemory::Memzero(*this); }
+	explicit FORCEINLINE TForce(EForceInit) { FMemory::Memzero(*this); }
 
-	FORCEINLINE_DEBUGGABLE void AddForce(const FVector& InForce, const FVector& InLocation, const FVector& InCOM)
+	FORCEINLINE_DEBUGGABLE void AddForce(const FVectorType& InForce, const FVectorType& InLocation, const FVectorType& InCOM)
 	{
 		#if WITH_WATER_PHYS_DEBUG
 		const float ForceSize	= Force.Size();
@@ -95,7 +99,7 @@ struct FForce
 		#endif
 
 		Force  += InForce;
-		Torque += FVector::CrossProduct(InLocation - InCOM, InForce);
+		Torque += FVectorType::CrossProduct(InLocation - InCOM, InForce);
 
 		checkf(this->IsValid(), TEXT("Invalid force: Force: %s, Torque: %s"), *Force.ToString(), *Torque.ToString());
 	}
@@ -104,9 +108,37 @@ struct FForce
 
 	FORCEINLINE bool IsValid() const { return !Force.ContainsNaN() && !Torque.ContainsNaN(); }
 
-	FORCEINLINE void operator+=(const FForce& Other) { Force += Other.Force; Torque += Other.Torque; }
+	FORCEINLINE_DEBUGGABLE void operator+=(const TForce& Other) 
+	{ 
+		#if WITH_WATER_PHYS_DEBUG
+		const float ForceSize      = Force.Size();
+		const float OtherForceSize = Other.Force.Size();
+		const float TotalSize      = ForceSize + OtherForceSize;
+		if (TotalSize > 0.f)
+			AvgLocation = (AvgLocation * (ForceSize / TotalSize)) + (Other.AvgLocation * (OtherForceSize / TotalSize));
+		#endif
+
+		Force  += Other.Force; 
+		Torque += Other.Torque; 
+	}
 };
 
+using FForce   = TForce<FVector::FReal>;
+using FForce3f = TForce<float>;
+
+// Moves a force accumulated in the space of the body into world space, the torque is around the center of mass in both
+template<typename T>
+FORCEINLINE FForce ToWorldForce(const TForce<T>& LocalForce, const FTransform& BodyTransform)
+{
+	FForce Result(ForceInit);
+	Result.Force       = BodyTransform.TransformVectorNoScale(FVector(LocalForce.Force));
+	Result.Torque      = BodyTransform.TransformVectorNoScale(FVector(LocalForce.Torque));
+	#if WITH_WATER_PHYS_DEBUG
+	Result.AvgLocation = BodyTransform.TransformPositionNoScale(FVector(LocalForce.AvgLocation));
+	#endif
+	return Result;
+}
+
 WATERPHYSICS_API void TransformSphereElem(FWaterPhysicsCollisionSetup::FSphereElem& SphereElem, const FTransform& Transform);
 
 WATERPHYSICS_API void TransformBoxElem(FWaterPhysicsCollisionSetup::FBoxElem& BoxElem, const FTransform& Transform);
@@ -115,4 +147,73 @@ WATERPHYSICS_API void TransformSphylElem(FWaterPhysicsCollisionSetup::FSphylElem
 
 WATERPHYSICS_API void TransformMeshElem(FWaterPhysicsCollisionSetup::FMeshElem& MeshElem, const FTransform& Transform);
 
-WATERPHYSICS_API WaterPhysics::FIndexedTriangleMesh ExtractConvexElemTriangles(const struct FKConvexElem& ConvexElem, bool bMirrorX);
\ No newline at end of file
+WATERPHYSICS_API WaterPhysics::FIndexedTriangleMesh ExtractConvexElemTriangles(const struct FKConvexElem& ConvexElem, bool bMirrorX);
+
+/*
+	Reduces Mesh to at most MaxTriangles triangles using quadric error edge collapses. 
+	Open and non-manifold edges are kept in place and the volume of closed meshes is preserved.
+*/
+WATERPHYSICS_API void SimplifyTriangleMesh(WaterPhysics::FIndexedTriangleMesh& Mesh, int32 MaxTriangles);
+
+// Volume (cm^3) and centroid of the part of a primitive which is below a water plane
+struct FSubmergedVolume
+{
+	float   Volume   = 0.f;
+	FVector Centroid = FVector::ZeroVector;
+
+	FORCEINLINE void operator+=(const FSubmergedVolume& Other)
+	{
+		const float TotalVolume = Volume + Other.Volume;
+		if (TotalVolume > 0.f)
+			Centroid = (Centroid * (Volume / TotalVolume)) + (Other.Centroid * (Other.Volume / TotalVolume));
+		Volume = TotalVolume;
+	}
+};
+
+WATERPHYSICS_API FSubmergedVolume CalcSphereSubmergedVolume(const FVector& Center, float Radius, const FPlane& WaterPlane);
+
+WATERPHYSICS_API FSubmergedVolume CalcBoxSubmergedVolume(const FVector& Center, const FQuat& Rotation, const FVector& HalfExtent, const FPlane& WaterPlane);
+
+WATERPHYSICS_API FSubmergedVolume CalcCapsuleSubmergedVolume(const FVector& Center, const FVector& Axis, float HalfHeight, float Radius, const FPlane& WaterPlane);
+
+// Signed distance (cm) from each vertex to the water surface plane sampled for it, Dot(Vertex, Normal) - PlaneW, negative below the surface. 
+// Everything is float SoA in the space of the body. Bit i % 32 of word i / 32 in OutSubmergedMask is set if vertex i is below the surface, 
+// the mask must hold FMath::DivideAndRoundUp(Num, 32) words.
+WATERPHYSICS_API void CalcVertexWaterDepths(const float* VertexX, const float* VertexY, const float* VertexZ, const float* NormalX, const float* NormalY, 
+	const float* NormalZ, const float* PlaneW, int32 Num, float* OutDepths, uint32* OutSubmergedMask);
+
+// Pow of four bases at a time, evaluated as exp2(Exponent * log2(Base)) with polynomial approximations of log2 and exp2. The relative
+// error stays below 2e-4 for exponents up to 10. Bases <= 0 return 0, or 1 if the exponent is 0, like FMath::Pow for a zero base.
+FORCEINLINE VectorRegister4Float VectorFastPow(const VectorRegister4Float& Base, const VectorRegister4Float& Exponent)
+{
+	// log2(Base) = unbiased exponent + log2(mantissa), the mantissa is in [1, 2)
+	const VectorRegister4Int   Bits     = VectorCastFloatToInt(Base);
+	const VectorRegister4Float BaseExp  = VectorIntToFloat(VectorIntSubtract(VectorShiftRightImmLogical(Bits, 23), VectorIntSet1(127)));
+	const VectorRegister4Float Mantissa = VectorCastIntToFloat(VectorIntOr(VectorIntAnd(Bits, VectorIntSet1(0x007FFFFF)), VectorIntSet1(0x3F800000)));
+	const VectorRegister4Float T        = VectorSubtract(Mantissa, VectorOneFloat());
+
+	VectorRegister4Float Log2 = VectorSetFloat1(0.04526829f);
+	Log2 = VectorMultiplyAdd(Log2, T, VectorSetFloat1(-0.19351652f));
+	Log2 = VectorMultiplyAdd(Log2, T, VectorSetFloat1(0.41524556f));
+	Log2 = VectorMultiplyAdd(Log2, T, VectorSetFloat1(-0.70886522f));
+	Log2 = VectorMultiplyAdd(Log2, T, VectorSetFloat1(1.44187990f));
+	Log2 = VectorMultiplyAdd(Log2, T, BaseExp);
+
+	// exp2(Y) = 2^floor(Y) * exp2(Y - floor(Y))
+	const VectorRegister4Float Y        = VectorMin(VectorMax(VectorMultiply(Log2, Exponent), VectorSetFloat1(-126.f)), VectorSetFloat1(127.f));
+	const VectorRegister4Float Floor    = VectorFloor(Y);
+	const VectorRegister4Float Fraction = VectorSubtract(Y, Floor);
+
+	VectorRegister4Float Exp2 = VectorSetFloat1(0.0018762334f);
+	Exp2 = VectorMultiplyAdd(Exp2, Fraction, VectorSetFloat1(0.0089925829f));
+	Exp2 = VectorMultiplyAdd(Exp2, Fraction, VectorSetFloat1(0.055823605f));
+	Exp2 = VectorMultiplyAdd(Exp2, Fraction, VectorSetFloat1(0.24015453f));
+	Exp2 = VectorMultiplyAdd(Exp2, Fraction, VectorSetFloat1(0.69315297f));
+	Exp2 = VectorMultiplyAdd(Exp2, Fraction, VectorSetFloat1(0.99999993f));
+
+	const VectorRegister4Float Scale  = VectorCastIntToFloat(VectorShiftLeftImm(VectorIntAdd(VectorFloatToInt(Floor), VectorIntSet1(127)), 23));
+	const VectorRegister4Float Result = VectorMultiply(Exp2, Scale);
+
+	const VectorRegister4Float ZeroBaseResult = VectorSelect(VectorCompareEQ(Exponent, VectorZeroFloat()), VectorOneFloat(), VectorZeroFloat());
+	return VectorSelect(VectorCompareGT(Base, VectorZeroFloat()), Result, ZeroBaseResult);
+}
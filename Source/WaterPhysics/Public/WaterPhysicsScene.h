@@ -3,33 +3,43 @@
 #pragma once
 #include "UObject/Object.h"
 #include "UObject/GCObject.h"
+#include "UObject/ObjectKey.h"
+#include "HAL/CriticalSection.h"
 #include "WaterPhysicsTypes.h"
+#include "WaterPhysicsFrameArena.h"
 
 class UActorComponent;
 class IWaterPhysicsCollisionInterface;
 struct FBodyInstance;
 struct FWaterSurfaceProvider;
 struct FKConvexElem;
+class UBodySetup;
 
 namespace WaterPhysics
 {
-	struct FSubmergedTriangleArray
+	struct FSubmergedTriangle
 	{
+		int32 Indices[3];
+		int32 OriginalTriangleIndex;
+	};
+
+	template<typename TVec>
+	struct TSubmergedTriangleArray
+	{
+		typedef TVec FVec;
+
 		struct FVertex
 		{
-			FVector Position;
-			FVector WaterVelocity;
-			float   Depth;
+			FVec  Position;
+			FVec  WaterVelocity;
+			float Depth;
+			FVec  WaterSurfaceNormal; // The surface point above the vertex is Position + WaterSurfaceNormal * Depth
 		};
 
-		struct FTriangle
-		{
-			int32 Indices[3];
-			int32 OriginalTriangleIndex;
-		};
+		typedef FSubmergedTriangle FTriangle;
 
-		typedef TArray<FVertex,   TInlineAllocator<InlineAllocSize()>> FVertexList;
-		typedef TArray<FTriangle, TInlineAllocator<InlineAllocSize()>> FTriangleList;
+		typedef TInlineFrameArray<FVertex,   InlineAllocSize()> FVertexList;
+		typedef TInlineFrameArray<FTriangle, InlineAllocSize()> FTriangleList;
 		
 		FVertexList   VertexList;
 		FTriangleList TriangleList;
@@ -45,12 +55,55 @@ namespace WaterPhysics
 		}
 	};
 
-	FIndexedTriangleMesh TriangulateWaterPhysicsCollisionSetup(const FWaterPhysicsCollisionSetup& CollisionSetup, const FTriangleSubdivisionSettings& SubdivisionSettings);
+	// In the space of the body, FSubmergedTriangleArray3f is used with bBodyRelativePrecision
+	typedef TSubmergedTriangleArray<FVector>   FSubmergedTriangleArray;
+	typedef TSubmergedTriangleArray<FVector3f> FSubmergedTriangleArray3f;
+
+	// Unique edge ids of a triangle mesh. Edge j of triangle i, going from corner j to corner (j + 1) % 3, has id EdgeIndexList[i * 3 + j].
+	struct FTriangleMeshEdges
+	{
+		FIndexList EdgeIndexList;
+		int32      NumEdges = 0;
+	};
+
+	FTriangleMeshEdges BuildTriangleMeshEdges(TConstArrayView<int32> IndexList);
+
+	FORCEINLINE FTriangleMeshEdges BuildTriangleMeshEdges(const FIndexedTriangleMesh& TriangleMesh) { return BuildTriangleMeshEdges(TConstArrayView<int32>(TriangleMesh.IndexList)); }
+
+	// Body space triangulation together with its edge topology, both stay the same for as long as the triangulation is cached
+	struct FBodyLocalMesh
+	{
+		FBodyLocalMesh() = default;
+		UE_NONCOPYABLE(FBodyLocalMesh); // IndexList may point into OwnedIndexList
+
+		FVertexList            VertexList;
+		TConstArrayView<int32> IndexList;                      // OwnedIndexList, or the indices of the shared icosphere / capsule template if the collision is a single sphere or capsule
+		FIndexList             OwnedIndexList;
+		TArray<float>          VertexX, VertexY, VertexZ;      // VertexList in single precision SoA, also the mesh used with bBodyRelativePrecision
+		FTriangleMeshEdges     Edges;
+		FSphere                Bounds   = FSphere(ForceInit);
+		bool                   bClosed  = false;               // Every edge is shared by exactly two triangles
+		float                  Volume   = 0.f;                 // Enclosed volume (cm3), only meaningful if bClosed
+		FVector                Centroid = FVector::ZeroVector; // Centroid of the enclosed volume
+
+		// Body space collision setup, only set if the collision consists of nothing but spheres, boxes and capsules (Used by EWaterPhysicsEvaluationMode::Analytic)
+		TSharedPtr<const FWaterPhysicsCollisionSetup, ESPMode::ThreadSafe> PrimitiveCollisionSetup;
+	};
+
+	// DebugName identifies the collision in the log, e.g. when overlapping elements could not be merged
+	FIndexedTriangleMesh TriangulateWaterPhysicsCollisionSetup(const FWaterPhysicsCollisionSetup& CollisionSetup, const FTriangleSubdivisionSettings& SubdivisionSettings, 
+		const TCHAR* DebugName = TEXT(""));
 
 	FWaterPhysicsCollisionSetup GenerateBodyInstanceWaterPhysicsCollisionSetup(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies);
 
+	// Same as GenerateBodyInstanceWaterPhysicsCollisionSetup but relative to the (weld parent) body transform, scale is still applied.
+	FWaterPhysicsCollisionSetup GenerateBodyInstanceLocalWaterPhysicsCollisionSetup(FBodyInstance* BodyInstance, bool bIncludeWeldedBodies);
+
 	FWaterPhysicsCollisionSetup GenerateWaterPhysicsCollisionSetup(const IWaterPhysicsCollisionInterface* CollisionInterface, const FName& BodyName);
 
+	// Same as GenerateWaterPhysicsCollisionSetup but only applies the scale of the collision world transform.
+	FWaterPhysicsCollisionSetup GenerateLocalWaterPhysicsCollisionSetup(const IWaterPhysicsCollisionInterface* CollisionInterface, const FName& BodyName, const FVector& Scale3D);
+
 };
 
 // Generic overridable interface for managing water surface getting.
@@ -65,6 +118,11 @@ struct WATERPHYSICS_API FWaterSurfaceProvider
 	virtual void DrawDebugProvider(UWorld* World) {};
 	virtual bool SupportsParallelExecution() const { return false; }
 
+	// Lowest and highest water surface over the XY extent of Bounds, used to skip bodies which are entirely above or below the water.
+	// Return false if the surface can't be bounded cheaply.
+	virtual bool GetWaterHeightBounds(const FBox& Bounds, const UActorComponent* Component, const FGetWaterInfoAtLocation& SurfaceGetter, 
+		FFloatInterval& OutHeightBounds) { return false; }
+
 	virtual FVertexWaterInfoArray CalculateVerticesWaterInfo(const WaterPhysics::FVertexList& Vertices, 
 		const UActorComponent* Component, const FGetWaterInfoAtLocation& SurfaceGetter) = 0;
 };
@@ -104,6 +162,30 @@ struct WATERPHYSICS_API FWaterPhysicsScene : public FGCObject
 		}
 	};
 
+	// Float SoA form of the triangle data for the SIMD force kernels, padded with zero area triangles to a multiple of four.
+	// Centroids are relative to the center of mass of the body.
+	struct FTriangleDataSoA
+	{
+		enum EField
+		{
+			CentroidX, CentroidY, CentroidZ,
+			NormalX, NormalY, NormalZ,
+			VelocityX, VelocityY, VelocityZ,
+			Area,
+			AvgDepth,
+			VelocitySize,
+			VelocityNormalDot,
+			NumFields
+		};
+
+		TArray<float, TWaterPhysicsFrameAllocator<16>> Fields; // Field major
+		WaterPhysics::TFrameArray<int32>               OriginalTriangleIndex;
+		int32                                          Num = 0;
+
+		FORCEINLINE float* GetField(EField Field) { return Fields.GetData() + Field * Num; }
+		FORCEINLINE VectorRegister4Float Load(EField Field, int32 Index) const { return VectorLoadAligned(Fields.GetData() + Field * Num + Index); }
+	};
+
 	struct FPersistentTriangleData
 	{
 		float SweptWaterArea;
@@ -126,30 +208,125 @@ struct WATERPHYSICS_API FWaterPhysicsScene : public FGCObject
 		FVector SlammingTorque;
 	};
 
+	// Everything which affects the body-local triangulation of a body. If any of these change the cached triangulation is rebuilt.
+	struct FTriangulationCacheKey
+	{
+		const void*                  CollisionSource = nullptr; // BodySetup for body instances, the component for collision interfaces
+		const FBodyInstance*         WeldParent      = nullptr;
+		FVector                      Scale3D         = FVector::ZeroVector;
+		FTransform                   WeldRelativeTM  = FTransform::Identity; // Welded bodies are triangulated in the space of their weld parent
+		FVector                      ParentScale3D   = FVector::ZeroVector;
+		uint32                       CollisionHash   = 0;
+		FTriangleSubdivisionSettings SubdivisionSettings;
+
+		FORCEINLINE bool operator==(const FTriangulationCacheKey& O) const
+		{
+			return CollisionSource == O.CollisionSource
+				&& WeldParent == O.WeldParent
+				&& Scale3D == O.Scale3D
+				&& WeldRelativeTM.Equals(O.WeldRelativeTM, 0.f)
+				&& ParentScale3D == O.ParentScale3D
+				&& CollisionHash == O.CollisionHash
+				&& SubdivisionSettings == O.SubdivisionSettings;
+		}
+	};
+
+	typedef TSharedPtr<const WaterPhysics::FBodyLocalMesh, ESPMode::ThreadSafe> FSharedBodyLocalMesh;
+
+	struct FTriangulationCache
+	{
+		FTriangulationCacheKey Key;
+
+		// Triangulated collision setup in body space, the step works on it in body space and only moves the results into world space
+		FSharedBodyLocalMesh LocalMesh; // Possibly shared with other bodies
+
+		FORCEINLINE bool IsValid(const FTriangulationCacheKey& InKey) const { return LocalMesh.IsValid() && Key == InKey; }
+		FORCEINLINE void Reset() { LocalMesh.Reset(); }
+	};
+
+	// Per triangle data of the body which carries over to the next step, for the current and the previous step
+	struct FPersistentTriangleFrames
+	{
+		TArray<FPersistentTriangleData> Frames[2];
+
+		void Empty() { Frames[0].Empty(); Frames[1].Empty(); }
+	};
+
+	// State of a body which is read and written by the scheduling and the step of every body, see FWaterPhysicsScene::Bodies.
+	// The rest of the state of the body lives in the arrays next to Bodies.
 	struct FWaterPhysicsBody
 	{
-		FWaterPhysicsBody(const FName& InBodyName, const FWaterPhysicsSettings& InWaterPhysicsSettings)
-			: BodyName(InBodyName)
-			, WaterPhysicsSettings(InWaterPhysicsSettings)
-			, ActingForces(ForceInit)
-		{}
+		uint32              MergedSettingsGeneration = 0; // Scene settings generation BodyMergedSettings was merged with, 0 if out of date
+		float               SubmergedArea = 0.f;
+		FTriangulationCache TriangulationCache;
+		bool                bAnalyticFallback = false; // The water around the body was too curved for EWaterPhysicsEvaluationMode::Analytic
+		float               StepCost = 0.f;            // Smoothed time (s) it takes to step the body, the most expensive bodies are scheduled first
+		bool                bStepCostSeeded = false;   // StepCost was estimated from a triangulation rebuilt during this step
+
+		static constexpr float TriangleStepCost() { return 1e-7f; } // Rough time (s) spent per triangle and step, only used to seed StepCost
+		static constexpr float VertexStepCost()   { return 2e-7f; } // Rough time (s) spent per vertex and step, dominated by the water query
 
-		FName                           BodyName;
-		FWaterPhysicsSettings           WaterPhysicsSettings;
-		TArray<FPersistentTriangleData> PersistentTriangleData[2];
-		FActingForces                   ActingForces;
-		float                           SubmergedArea;
+		// Bodies which have never been stepped have to be triangulated first, which makes them the most expensive ones to schedule
+		FORCEINLINE float GetScheduledStepCost() const { return StepCost > 0.f ? StepCost : MAX_flt; }
+
+		// Estimates StepCost from the size of a newly built triangulation, the step which rebuilt it is dominated by the rebuild and not measured
+		void SeedStepCost(int32 NumTriangles, int32 NumVertices)
+		{
+			StepCost        = FMath::Max(NumTriangles * TriangleStepCost() + NumVertices * VertexStepCost(), UE_SMALL_NUMBER);
+			bStepCostSeeded = true;
+		}
 
-		void ClearTriangleData() { PersistentTriangleData[0].Empty(); PersistentTriangleData[1].Empty(); }
+		// Folds the measured time of this step into StepCost
+		void UpdateStepCost(uint64 StepCycles)
+		{
+			if (bStepCostSeeded)
+			{
+				bStepCostSeeded = false;
+				return;
+			}
+
+			const float StepTime = (float)FPlatformTime::ToSeconds64(StepCycles);
+			StepCost = StepCost > 0.f ? FMath::Lerp(StepCost, StepTime, 0.25f) : StepTime;
+		}
+	};
+
+	// Stable reference to a body of the scene. Bodies move around in the dense arrays as others are removed, the handle stays valid until the body itself is removed.
+	struct FWaterPhysicsBodyHandle
+	{
+		int32  Slot   = INDEX_NONE;
+		uint32 Serial = 0;
+
+		FORCEINLINE bool IsValid() const { return Slot != INDEX_NONE; }
+		FORCEINLINE bool operator==(const FWaterPhysicsBodyHandle& O) const { return Slot == O.Slot && Serial == O.Serial; }
 	};
 
-	typedef TMap<TObjectPtr<const UActorComponent>, TArray<FWaterPhysicsBody>> FWaterPhysicsBodies;
+	typedef TArray<FWaterPhysicsBodyHandle, TInlineAllocator<1>> FComponentBodyHandles;
+
+	// Identifies body-local triangulations which can be shared between bodies, e.g. many instances of the same static mesh
+	struct FSharedTriangulationKey
+	{
+		TObjectKey<UBodySetup>       BodySetup;
+		uint32                       CollisionHash; // Changes when the collision of the BodySetup is edited, e.g. in the editor
+		FVector                      Scale3D;
+		FTriangleSubdivisionSettings SubdivisionSettings;
+
+		FORCEINLINE bool operator==(const FSharedTriangulationKey& O) const 
+		{ 
+			return BodySetup == O.BodySetup && CollisionHash == O.CollisionHash && Scale3D == O.Scale3D && SubdivisionSettings == O.SubdivisionSettings; 
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash(const FSharedTriangulationKey& O)
+		{
+			return HashCombine(HashCombine(HashCombine(GetTypeHash(O.BodySetup), O.CollisionHash), GetTypeHash(O.Scale3D)), GetTypeHash(O.SubdivisionSettings));
+		}
+	};
 
 	struct FFrameInfo
 	{
-		TArray<FPersistentTriangleData>& CurrentFrame;
-		TArray<FPersistentTriangleData>& PreviousFrame;
-		TArray<FTriangleData>            TriangleData;
+		TArray<FPersistentTriangleData>&         CurrentFrame;
+		TArray<FPersistentTriangleData>&         PreviousFrame;
+		WaterPhysics::TFrameArray<FTriangleData> TriangleData;    // Only valid until the end of the step, only set up for the scalar force loops
+		FTriangleDataSoA                         TriangleDataSoA; // Only valid until the end of the step, only set up for the SIMD force kernels
 		FVector AvgFluidVelocity;
 		bool    bSuccess;
 		float   TotalSubmergedArea;
@@ -166,88 +343,152 @@ struct WATERPHYSICS_API FWaterPhysicsScene : public FGCObject
 private:
 
 	int32 CurrentBufferIndex = 0;
-	FWaterPhysicsBodies WaterPhysicsBodies;
+
+	// Body registry. The arrays below are indexed by the dense body index and kept in sync, removal swaps the last body into the gap.
+	// Bodies and BodyComponents are read for every body when scheduling, the next four only by the step of the body itself and the 
+	// rest when bodies are added, removed or their settings change.
+	TArray<FWaterPhysicsBody>                 Bodies;
+	TArray<TObjectPtr<const UActorComponent>> BodyComponents;
+	TArray<FName>                             BodyNames;
+	TArray<FWaterPhysicsSettings>             BodyMergedSettings; // Settings of the body merged with the scene settings
+	TArray<FActingForces>                     BodyActingForces;
+	TArray<FPersistentTriangleFrames>         BodyTriangleFrames;
+	TArray<FWaterPhysicsSettings>             BodySettings;       // Settings the body was added with, before merging with the scene settings
+	TArray<FWaterPhysicsBodyHandle>           BodyHandles;
+	TArray<FObjectKey>                        BodyComponentKeys;  // Still identifies the component once BodyComponents has been cleared by GC
+
+	struct FBodySlot
+	{
+		int32  BodyIndex = INDEX_NONE; // Dense body index, INDEX_NONE if the slot is free
+		uint32 Serial    = 0;          // Bumped every time the slot is freed so stale handles no longer resolve
+	};
+	TArray<FBodySlot> BodySlots;
+	TArray<int32>     FreeBodySlots;
+
+	// Bodies of each component, only used for lookups from gameplay code
+	TMap<FObjectKey, FComponentBodyHandles> ComponentBodyHandles;
+
+	void RemoveBodyAt(int32 BodyIndex);
+	bool RemoveComponentBodies(const FObjectKey& ComponentKey);
+
+	// Components which might have been destroyed since the last step, checked and removed in one batch at the start of the next step.
+	// Components without physics state are not reported when destroyed, their references are cleared by GC which triggers a full sweep instead.
+	TArray<FObjectKey> PendingComponentChecks;
+	bool               bSweepInvalidComponents = false;
+	FDelegateHandle    DestroyPhysicsStateHandle;
+	FDelegateHandle    PostGarbageCollectHandle;
+
+	void OnComponentDestroyPhysicsState(UActorComponent* Component);
+	void OnPostGarbageCollect() { bSweepInvalidComponents = true; }
+	void RemoveInvalidComponents();
+
+	// Bumped whenever the scene settings passed to StepWaterPhysicsScene change, bodies re-merge their settings when their generation differs
+	FWaterPhysicsSettings CachedSceneSettings;
+	uint32                SceneSettingsGeneration = 1;
+
+	// Weak so that the memory is released as soon as the last body using a triangulation is removed
+	TMap<FSharedTriangulationKey, TWeakPtr<const WaterPhysics::FBodyLocalMesh, ESPMode::ThreadSafe>> SharedTriangulations;
+	FCriticalSection SharedTriangulationsCS;
+
+	// Backs the temporaries of this scene's step, scenes never reset memory another scene's step is still using
+	FWaterPhysicsFrameArena FrameArena;
 
 public:
 
-	FORCEINLINE FWaterPhysicsBody* AddComponentBody(const UActorComponent* Component, const FName& BodyName, const FWaterPhysicsSettings& WaterPhysicsSettings)
-	{ 
-		if (TArray<FWaterPhysicsBody>* Bodies = WaterPhysicsBodies.Find(Component))
-		{
-			if (FWaterPhysicsBody* Body = Bodies->FindByPredicate([&](const auto& X) { return X.BodyName == BodyName; }))
-			{
-				Body->WaterPhysicsSettings = WaterPhysicsSettings;
-				Body->ClearTriangleData();
-				return Body;
-			}
-			else
-			{
-				return &(*Bodies)[Bodies->Emplace(BodyName, WaterPhysicsSettings)];
-			}
-		}
-		else
-		{
-			TArray<FWaterPhysicsBody>& AddedBodies = WaterPhysicsBodies.Add(Component);
-			return &AddedBodies[AddedBodies.Emplace(BodyName, WaterPhysicsSettings)];
-		}
+	FWaterPhysicsScene();
+	virtual ~FWaterPhysicsScene();
+
+	FWaterPhysicsBodyHandle AddComponentBody(const UActorComponent* Component, const FName& BodyName, const FWaterPhysicsSettings& WaterPhysicsSettings);
+
+	bool RemoveBody(const FWaterPhysicsBodyHandle& Handle);
+
+	bool RemoveComponent(const UActorComponent* Component);
+
+	FORCEINLINE bool RemoveComponentBody(const UActorComponent* Component, const FName& BodyName) 
+	{
+		return RemoveBody(FindComponentBody(Component, BodyName));
 	}
 
-	FORCEINLINE bool RemoveComponent(const UActorComponent* Component) 
-	{ 
-		return WaterPhysicsBodies.Remove(Component) != 0; 
+	FORCEINLINE int32 GetBodyIndex(const FWaterPhysicsBodyHandle& Handle) const
+	{
+		return Handle.IsValid() && BodySlots.IsValidIndex(Handle.Slot) && BodySlots[Handle.Slot].Serial == Handle.Serial ? BodySlots[Handle.Slot].BodyIndex : INDEX_NONE;
 	}
 
-	FORCEINLINE bool RemoveComponentBody(const UActorComponent* Component, const FName& BodyName) 
+	FORCEINLINE const FWaterPhysicsBody* GetBody(const FWaterPhysicsBodyHandle& Handle) const
 	{
-		if (TArray<FWaterPhysicsBody>* Bodies = WaterPhysicsBodies.Find(Component))
-			return Bodies->RemoveAll([&](const auto& X) { return X.BodyName == BodyName; }) != 0;
-		return false;
+		const int32 BodyIndex = GetBodyIndex(Handle);
+		return BodyIndex != INDEX_NONE ? &Bodies[BodyIndex] : nullptr;
 	}
 
-	FORCEINLINE const TArray<FWaterPhysicsBody>* FindComponentBodies(const UActorComponent* Component) const
+	FORCEINLINE FWaterPhysicsBody* GetBody(const FWaterPhysicsBodyHandle& Handle)
 	{
-		return WaterPhysicsBodies.Find(Component);
+		const int32 BodyIndex = GetBodyIndex(Handle);
+		return BodyIndex != INDEX_NONE ? &Bodies[BodyIndex] : nullptr;
 	}
 
-	FORCEINLINE TArray<FWaterPhysicsBody>* FindComponentBodies(const UActorComponent* Component)
+	FORCEINLINE FName GetBodyName(const FWaterPhysicsBodyHandle& Handle) const
 	{
-		return WaterPhysicsBodies.Find(Component);
+		const int32 BodyIndex = GetBodyIndex(Handle);
+		return BodyIndex != INDEX_NONE ? BodyNames[BodyIndex] : NAME_None;
 	}
 
-	FORCEINLINE bool ContainsComponent(const UActorComponent* Component) const
+	FORCEINLINE const FActingForces* GetBodyActingForces(const FWaterPhysicsBodyHandle& Handle) const
 	{
-		return WaterPhysicsBodies.Contains(Component);
+		const int32 BodyIndex = GetBodyIndex(Handle);
+		return BodyIndex != INDEX_NONE ? &BodyActingForces[BodyIndex] : nullptr;
 	}
 
-	FORCEINLINE const FWaterPhysicsBody* FindComponentBody(const UActorComponent* Component, const FName& BodyName) const
+	FORCEINLINE void SetBodyWaterPhysicsSettings(const FWaterPhysicsBodyHandle& Handle, const FWaterPhysicsSettings& WaterPhysicsSettings)
 	{
-		if (const TArray<FWaterPhysicsBody>* Bodies = WaterPhysicsBodies.Find(Component))
-			if (const FWaterPhysicsBody* PersistentBodyData = Bodies->FindByPredicate([&](const auto& V) { return V.BodyName == BodyName; }))
-				return PersistentBodyData;
+		const int32 BodyIndex = GetBodyIndex(Handle);
+		if (BodyIndex != INDEX_NONE)
+		{
+			BodySettings[BodyIndex]                    = WaterPhysicsSettings;
+			Bodies[BodyIndex].MergedSettingsGeneration = 0;
+		}
+	}
 
-		return nullptr;
+	FORCEINLINE TConstArrayView<FWaterPhysicsBodyHandle> FindComponentBodies(const UActorComponent* Component) const
+	{
+		const FComponentBodyHandles* Handles = ComponentBodyHandles.Find(FObjectKey(Component));
+		return Handles ? TConstArrayView<FWaterPhysicsBodyHandle>(*Handles) : TConstArrayView<FWaterPhysicsBodyHandle>();
 	}
 
-	FORCEINLINE FWaterPhysicsBody* FindComponentBody(const UActorComponent* Component, const FName& BodyName)
+	FORCEINLINE bool ContainsComponent(const UActorComponent* Component) const
 	{
-		if (TArray<FWaterPhysicsBody>* Bodies = WaterPhysicsBodies.Find(Component))
-			if (FWaterPhysicsBody* PersistentBodyData = Bodies->FindByPredicate([&](const auto& V) { return V.BodyName == BodyName; }))
-				return PersistentBodyData;
+		return ComponentBodyHandles.Contains(FObjectKey(Component));
+	}
 
-		return nullptr;
+	FORCEINLINE FWaterPhysicsBodyHandle FindComponentBody(const UActorComponent* Component, const FName& BodyName) const
+	{
+		for (const FWaterPhysicsBodyHandle& Handle : FindComponentBodies(Component))
+		{
+			if (GetBodyName(Handle) == BodyName)
+				return Handle;
+		}
+		return FWaterPhysicsBodyHandle();
 	}
 
 	FORCEINLINE void ClearTriangleData(const UActorComponent* Component, FName BodyName)
 	{
-		if (FWaterPhysicsBody* Body = FindComponentBody(Component, BodyName))
-			Body->ClearTriangleData();
+		const int32 BodyIndex = GetBodyIndex(FindComponentBody(Component, BodyName));
+		if (BodyIndex != INDEX_NONE)
+			BodyTriangleFrames[BodyIndex].Empty();
+	}
+
+	// Force the triangulation of the components bodies to be rebuilt next step. 
+	// Only needed if the collision changes in a way which is not captured by FTriangulationCacheKey.
+	FORCEINLINE void InvalidateTriangulationCache(const UActorComponent* Component)
+	{
+		for (const FWaterPhysicsBodyHandle& Handle : FindComponentBodies(Component))
+			GetBody(Handle)->TriangulationCache.Reset();
 	}
 
 	FORCEINLINE int32 GetFrameIndex(EFrame Frame) const { return FMath::Abs(CurrentBufferIndex - Frame); }
 
 	FORCEINLINE void SwapBuffers() { CurrentBufferIndex = 1 - CurrentBufferIndex; }
 
-	FORCEINLINE void ClearWaterPhysicsScene() { WaterPhysicsBodies.Reset(); }
+	void ClearWaterPhysicsScene();
 
 	void StepWaterPhysicsScene(float DeltaTime, const FVector& Gravity, const FWaterPhysicsSettings& SceneSettings, 
 		const FGetWaterInfoAtLocation& SurfaceGetter, bool bSurfaceGetterThreadSafe, FWaterSurfaceProvider* WaterSurfaceProvider, UObject* DebugContext);
@@ -257,35 +498,84 @@ public:
 
 private:
 
-	FFrameInfo InitFrame(FWaterPhysicsBody& WaterPhysicsBody,
-		const WaterPhysics::FIndexedTriangleMesh& TriangulatedBody, const WaterPhysics::FSubmergedTriangleArray& SubmergedTriangles,
-		const FVector& BodyCenterOfMass, const FVector& BodyLinearVelocity, const FVector& BodyAngularVelocity);
+	// Everything is in the space of the body, the resulting triangle data too. The triangles are set up in the precision of SubmergedTriangles 
+	// and written straight into the layouts asked for, the swept water area of the current frame is accumulated as well. Large bodies are set up
+	// in parallel ranges.
+	template<typename FVec>
+	FFrameInfo InitFrame(FPersistentTriangleFrames& TriangleFrames,
+		const WaterPhysics::FBodyLocalMesh& LocalMesh, const WaterPhysics::TSubmergedTriangleArray<FVec>& SubmergedTriangles,
+		const FVector& BodyCenterOfMass, const FVector& BodyLinearVelocity, const FVector& BodyAngularVelocity, bool bTriangleData, bool bTriangleDataSoA, 
+		int32 ParallelTriangleThreshold);
+
+	// Kinematic state of the root (weld parent) body instance
+	struct FBodyState
+	{
+		FTransform Transform;
+		FVector    LinearVelocity;
+		FVector    AngularVelocity;
+		FVector    CenterOfMass;
+		FVector    InertiaTensor;
+		float      Mass;
+	};
 
 	struct FWaterBodyProcessingResult
 	{
-		FBodyInstance*         BodyInstance; // Not necessarily the root body instance, could be welded
-		FWaterPhysicsSettings  WaterPhysicsSettings;
-		bool                   bHasWaterPhysicsCollisionInterface;
+		FBodyInstance*               BodyInstance;                   // Not necessarily the root body instance, could be welded
+		const FWaterPhysicsSettings* WaterPhysicsSettings = nullptr; // BodyMergedSettings of the body
+		FBodyState                   BodyState;                      // Set by ReadBodyStates
+		bool                         bHasWaterPhysicsCollisionInterface;
+
+		FORCEINLINE FBodyInstance* GetRootBodyInstance() const { return BodyInstance->WeldParent ? BodyInstance->WeldParent : BodyInstance; }
 	};
-	FWaterBodyProcessingResult ProcessWaterPhysicsBody(const UActorComponent* Component, FWaterPhysicsBody& WaterBody, const FWaterPhysicsSettings& SceneSettings);
+	FWaterBodyProcessingResult ProcessWaterPhysicsBody(const UActorComponent* Component, int32 BodyIndex, const FWaterPhysicsSettings& SceneSettings);
+
+	// Reads the state of all processed bodies up front, taking the physics scene read lock once instead of once per body and stage.
+	// Bodies whose state could not be read are skipped by clearing their BodyInstance.
+	static void ReadBodyStates(TArrayView<FWaterBodyProcessingResult> BodyProcessingResults);
+
+	FSharedBodyLocalMesh FindOrAddSharedTriangulation(const FSharedTriangulationKey& Key, TFunctionRef<FSharedBodyLocalMesh()> BuildLocalMesh);
 
 	struct FBodyTriangulationResult
 	{
-		const FWaterBodyProcessingResult*  BodyProcessingResult;
+		const FWaterBodyProcessingResult* BodyProcessingResult;
+
+		FSharedBodyLocalMesh LocalMesh; // The cached body space mesh, the step never copies it into world space
 
-		WaterPhysics::FIndexedTriangleMesh TriangulatedBody;
+		// Set if the body is evaluated analytically, AnalyticSamplePoints then holds the world space points to sample the water surface at
+		TSharedPtr<const FWaterPhysicsCollisionSetup, ESPMode::ThreadSafe> AnalyticCollisionSetup;
+		WaterPhysics::FVertexList                                          AnalyticSamplePoints;
+		FTransform                                                         BodyTransform; // Body space to world space of LocalMesh/AnalyticCollisionSetup
+
+		FORCEINLINE bool IsAnalytic() const { return AnalyticCollisionSetup.IsValid(); }
+		FORCEINLINE bool IsEmpty() const { return !IsAnalytic() && (!LocalMesh.IsValid() || LocalMesh->IndexList.Num() == 0); }
+	};
+	FBodyTriangulationResult TriangulateBody(const UActorComponent* Component, int32 BodyIndex, const FWaterBodyProcessingResult& BodyProcessingResult);
+
+	enum class EBodyWaterState : uint8
+	{
+		Partial,  // Intersects the water surface, or we could not tell
+		Dry,      // Entirely above the water
+		Submerged // Entirely below the water
 	};
-	FBodyTriangulationResult TriangulateBody(const UActorComponent* Component, const FWaterPhysicsBody& WaterBody, const FWaterBodyProcessingResult& BodyProcessingResult);
 
 	struct FFetchWaterSurfaceInfoResult
 	{
 		const FWaterBodyProcessingResult*  BodyProcessingResult;
 		const FBodyTriangulationResult*    BodyTriangulationResult;
 
+		EBodyWaterState WaterState = EBodyWaterState::Partial;
+
+		// Per vertex water info for partially submerged bodies, empty otherwise. World space, as returned by the surface getter.
 		FWaterSurfaceProvider::FVertexWaterInfoArray VertexWaterInfo;
+
+		// The water at the center of the body, used for all vertices of a submerged body
+		FGetWaterInfoResult BodyWaterInfo;
 	};
+	EBodyWaterState ClassifyBodyWaterState(const UActorComponent* Component, const FBodyTriangulationResult& BodyTriangulationResult, EWaterInfoFetchingMethod WaterInfoFetchingMethod,
+		const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider, FGetWaterInfoResult& OutBodyWaterInfo);
+
 	FFetchWaterSurfaceInfoResult FetchWaterSurfaceInfo(const UActorComponent* Component, const FWaterPhysicsBody& WaterBody, const FBodyTriangulationResult& BodyTriangulationResult,
-		EWaterInfoFetchingMethod WaterInfoFetchingMethod, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider);
+		const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider);
 
 	struct FBodyWaterIntersectionResult
 	{
@@ -293,16 +583,58 @@ private:
 		const FBodyTriangulationResult*     BodyTriangulationResult;
 		const FFetchWaterSurfaceInfoResult* FetchWaterSurfaceInfoResult;
 
-		WaterPhysics::FSubmergedTriangleArray SubmergedTriangleArray;
+		// FFetchWaterSurfaceInfoResult::VertexWaterInfo/BodyWaterInfo moved into body space, not set for dry and analytic bodies
+		FWaterSurfaceProvider::FVertexWaterInfoArray LocalVertexWaterInfo;
+		FGetWaterInfoResult                          LocalBodyWaterInfo;
+
+		// Depth of each vertex of a partially submerged body, negative below the surface, see CalcVertexWaterDepths
+		WaterPhysics::TInlineFrameArray<float, WaterPhysics::InlineAllocSize()>       VertexDepths;
+		WaterPhysics::TInlineFrameArray<uint32, WaterPhysics::InlineAllocSize() / 32> SubmergedMask;
+
+		// Only one of the two is used, the single precision one with bBodyRelativePrecision
+		WaterPhysics::FSubmergedTriangleArray   SubmergedTriangleArray;
+		WaterPhysics::FSubmergedTriangleArray3f SubmergedTriangleArray3f;
+		bool                                    bSinglePrecision   = false;
+		int32                                   NumSampledVertices = 0; // Vertices before these were inserted by the submerged tessellation
+
+		template<typename FuncType>
+		FORCEINLINE auto VisitSubmergedTriangles(FuncType&& Func) { return bSinglePrecision ? Func(SubmergedTriangleArray3f) : Func(SubmergedTriangleArray); }
+
+		template<typename FuncType>
+		FORCEINLINE auto VisitSubmergedTriangles(FuncType&& Func) const { return bSinglePrecision ? Func(SubmergedTriangleArray3f) : Func(SubmergedTriangleArray); }
 	};
 	FBodyWaterIntersectionResult BodyWaterIntersection(const FFetchWaterSurfaceInfoResult& FetchWaterSurfaceInfoResult);
 
-	void CalculateWaterForces(const UActorComponent* Component, FWaterPhysicsBody& WaterBody, const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, 
-		float DeltaTime, const FVector& Gravity);
+	// Fetches the water at the vertices inserted by the submerged tessellation, which otherwise only interpolate the samples of their edge
+	// and would not change the forces. Uses the surface getter, so it runs wherever FetchWaterSurfaceInfo does.
+	void SampleSubmergedTessellation(const UActorComponent* Component, FBodyWaterIntersectionResult& BodyWaterIntersectionResult, 
+		const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider);
+
+	// Total water force of a body, written by the parallel stages and applied to all bodies at once by ApplyBodyForces
+	struct FBodyForceOutput
+	{
+		FBodyInstance* BodyInstance = nullptr; // Root body instance, nothing is applied if not set
+		FVector        Force        = FVector::ZeroVector;
+		FVector        Torque       = FVector::ZeroVector;
+	};
+
+	// Applies the forces of all bodies, taking the physics scene write lock once instead of once per body and force
+	static void ApplyBodyForces(TArrayView<const FBodyForceOutput> BodyForces);
+
+	void CalculateWaterForces(const UActorComponent* Component, int32 BodyIndex, const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, 
+		float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce);
+
+	void CalculateAnalyticWaterForces(const UActorComponent* Component, int32 BodyIndex, const FFetchWaterSurfaceInfoResult& FetchWaterSurfaceInfoResult, 
+		float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce);
+
+	void CalculateFusedWaterForces(const UActorComponent* Component, int32 BodyIndex, const FBodyWaterIntersectionResult& BodyWaterIntersectionResult, 
+		float DeltaTime, const FVector& Gravity, FBodyForceOutput& OutBodyForce);
+
+	typedef WaterPhysics::TFrameArray<int32> FWaterBodyList; // Dense body indices in the order they are stepped
 
-	void StepWaterBodies_Synchronous(TArray<TPair<const UActorComponent*, FWaterPhysicsBody*>>& WaterBodies, float DeltaTime, const FVector& Gravity, 
+	void StepWaterBodies_Synchronous(FWaterBodyList& WaterBodies, float DeltaTime, const FVector& Gravity, 
 		const FWaterPhysicsSettings& SceneSettings, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider);
 
-	void StepWaterBodies_Parallel(TArray<TPair<const UActorComponent*, FWaterPhysicsBody*>>& WaterBodies, float DeltaTime, const FVector& Gravity, 
+	void StepWaterBodies_Parallel(FWaterBodyList& WaterBodies, float DeltaTime, const FVector& Gravity, 
 		const FWaterPhysicsSettings& SceneSettings, const FGetWaterInfoAtLocation& SurfaceGetter, FWaterSurfaceProvider* WaterSurfaceProvider);
 };
\ No newline at end of file
@@ -82,6 +82,18 @@ protected:
 
 	TSharedPtr<FWaterSurfaceProvider> WaterSurfaceProvider;
 
+	struct FPhysicsStateBodyResolve
+	{
+		FWaterPhysicsSettings Settings;
+		TArray<FName>         RemovedBodyNames; // Bodies removed one by one, which are not added back when the physics state is recreated
+	};
+
+	// Primitive components added with all their bodies. The bodies are resolved from the physics state, again every time it is created.
+	// Components added before their physics state was created have no bodies in the scene until then.
+	TMap<FObjectKey, FPhysicsStateBodyResolve> PhysicsStateBodyResolves;
+	FDelegateHandle CreatePhysicsStateHandle;
+	FDelegateHandle PostGarbageCollectHandle;
+
 public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(ShowOnlyInnerProperties))
@@ -222,4 +234,10 @@ protected:
 
 	virtual TSharedPtr<FWaterSurfaceProvider> MakeWaterSurfaceProvider() const;
 
+	// Matches the bodies of the component in the scene to the ones of its physics state. bResetExistingBodies also applies the settings to bodies already in the scene.
+	void ResolveComponentBodies(UPrimitiveComponent* PrimitiveComponent, const FPhysicsStateBodyResolve& BodyResolve, bool bResetExistingBodies);
+
+	void OnComponentCreatePhysicsState(UActorComponent* Component);
+	void OnPostGarbageCollect();
+
 };
\ No newline at end of file
@@ -36,6 +36,19 @@ enum class EWaterInfoFetchingMethod : uint8
 	PerObject
 };
 
+UENUM()
+enum class EWaterPhysicsEvaluationMode : uint8
+{
+	// Triangulate the collision and integrate the forces over the submerged triangles. Works for any collision and water surface.
+	Triangles,
+	// Use closed form solutions for bodies which only consist of spheres, boxes and capsules. Falls back to Triangles if the 
+	// body has other collision, or if the water surface around the body is not close to planar.
+	Analytic,
+	// Same model as Triangles, but each triangle is clipped and its forces accumulated in a single pass without storing the submerged
+	// triangles in between. Ignores the submerged tessellation settings and only outputs debug information for the whole body.
+	Fused
+};
+
 UENUM()
 enum class EWaterPhysicsDebugLevel : uint8
 {
@@ -47,8 +60,10 @@ enum class EWaterPhysicsDebugLevel : uint8
 UENUM()
 enum class EWaterPhysicsTessellationMode : uint8
 {
-	Levels = 0,
-	Area   = 1
+	Levels    = 0,
+	Area      = 1,
+	// Only subdivide triangles close to the water surface, plus any triangle larger than MaxAreaOutsideWaterline
+	Waterline = 2
 };
 
 USTRUCT(BlueprintType)
@@ -66,6 +81,14 @@ struct FTessellationSettings
 	// Nr of times to subdived all triangles
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Tessellation Settings", meta=(UIMin="0", UIMax="5", ClampMin="0"))
 	int32 Levels = 1;
+
+	// Triangles with a vertex less than this deep (cm) are subdivided to MaxArea in Waterline mode
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Tessellation Settings", meta=(UIMin="0", UIMax="200", ClampMin="0", EditCondition="TessellationMode == EWaterPhysicsTessellationMode::Waterline"))
+	float WaterlineBand = 50.f;
+
+	// Minimum area (m^2) to subdivide triangles outside the waterline band to in Waterline mode, 0 leaves them as is
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Tessellation Settings", meta=(UIMin="0", UIMax="20", ClampMin="0", EditCondition="TessellationMode == EWaterPhysicsTessellationMode::Waterline"))
+	float MaxAreaOutsideWaterline = 0.f;
 };
 
 USTRUCT(BlueprintType)
@@ -84,6 +107,24 @@ struct WATERPHYSICS_API FTriangleSubdivisionSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Subdivision Settings", meta=(UIMin="0", UIMax="5", ClampMin="0"))
 	int32 Capsule = 0;
+
+	/*
+		Upper limit on the number of triangles sourced from mesh collision (Convex hulls and static meshes) per body, before subdivision.
+		Meshes exceeding the limit are simplified once when the body is triangulated. 0 means no limit.
+		The limit can still be exceeded as every mesh keeps at least 4 triangles and open edges are never collapsed, e.g. by a body
+		made of more than MaxMeshTriangles / 4 convex hulls.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Subdivision Settings", meta=(UIMin="0", ClampMin="0"))
+	int32 MaxMeshTriangles = 0;
+
+	FORCEINLINE bool operator==(const FTriangleSubdivisionSettings& O) const { return Box == O.Box && Convex == O.Convex && Sphere == O.Sphere && Capsule == O.Capsule && MaxMeshTriangles == O.MaxMeshTriangles; }
+	FORCEINLINE bool operator!=(const FTriangleSubdivisionSettings& O) const { return !(*this == O); }
+
+	FORCEINLINE friend uint32 GetTypeHash(const FTriangleSubdivisionSettings& O)
+	{
+		const uint32 Hash = HashCombine(HashCombine(::GetTypeHash(O.Box), ::GetTypeHash(O.Convex)), HashCombine(::GetTypeHash(O.Sphere), ::GetTypeHash(O.Capsule)));
+		return HashCombine(Hash, ::GetTypeHash(O.MaxMeshTriangles));
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -100,6 +141,18 @@ struct WATERPHYSICS_API FWaterPhysicsSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
 	uint8 bOverride_WaterInfoFetchingMethod:1;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_EvaluationMode:1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_AnalyticMaxSurfaceDeviation:1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_bBodyRelativePrecision:1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
+	uint8 bOverride_ParallelTriangleThreshold:1;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Overrides, meta=(PinHiddenByDefault, InlineEditConditionToggle))
 	uint8 bOverride_SubdivisionSettings:1;
 
@@ -174,6 +227,10 @@ struct WATERPHYSICS_API FWaterPhysicsSettings
 		: bOverride_FluidDensity(0)
 		, bOverride_FluidKinematicViscocity(0)
 		, bOverride_WaterInfoFetchingMethod(0)
+		, bOverride_EvaluationMode(0)
+		, bOverride_AnalyticMaxSurfaceDeviation(0)
+		, bOverride_bBodyRelativePrecision(0)
+		, bOverride_ParallelTriangleThreshold(0)
 		, bOverride_SubdivisionSettings(0)
 		, bOverride_SubmergedTessellationSettings(0)
 		, bOverride_PressureCoefficientOfLinearSpeed(0)
@@ -224,10 +281,53 @@ struct WATERPHYSICS_API FWaterPhysicsSettings
 		optimized for precision and speed. If your objects do not require an accurate water surface you could the "PerObject" option 
 		which only fetch the water surface once per object. This will greatly improve performance at the cost of wave accuracy.	The per vertex 
 		option is not recommended unless you know what you are doing.
+
+		A body which is entirely below the water surface only fetches the water at its center, with any method but "PerVertex". The plane 
+		and water velocity of that one sample are then applied to every vertex, waves and currents across the body are not resolved.
 	*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_WaterInfoFetchingMethod"))
 	EWaterInfoFetchingMethod WaterInfoFetchingMethod = EWaterInfoFetchingMethod::WaterSurfaceProvider;
 
+	/*
+		Evaluation Mode
+
+		How the water forces of the body are calculated. The analytic mode is much cheaper for simple props made of spheres, boxes and capsules 
+		but only supports planar water, and approximates the drag using the projected area of the body instead of per triangle.
+		Slamming forces are not calculated by the analytic mode.
+		The fused mode gives the same result as the triangle mode, except that the fluid travel length of the viscous resistance is 
+		approximated with the bounds of the submerged part of the body. It is faster for bodies with many triangles.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_EvaluationMode"))
+	EWaterPhysicsEvaluationMode EvaluationMode = EWaterPhysicsEvaluationMode::Triangles;
+
+	/*
+		Analytic Max Surface Deviation
+
+		How far (cm) the water surface around a body may deviate from a plane before the analytic evaluation mode falls back to triangles.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_AnalyticMaxSurfaceDeviation", UIMin="0", ClampMin="0"))
+	float AnalyticMaxSurfaceDeviation = 10.f;
+
+	/*
+		Body Relative Precision
+
+		Clip and integrate the triangles of the body in single instead of double precision, in both the triangle and the fused mode. 
+		The geometry is always kept in the space of the body, so single precision does not lose accuracy far from the world origin, 
+		and it halves the size of the per vertex data.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_bBodyRelativePrecision"))
+	bool bBodyRelativePrecision = false;
+
+	/*
+		Parallel Triangle Threshold
+
+		Bodies with at least this many triangles are split into ranges of triangles processed by parallel tasks, instead of the whole 
+		body running on a single worker. The fused mode clips and integrates the ranges, the triangle mode sets up the submerged 
+		triangles and runs the force kernels on them. 0 disables the split.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_ParallelTriangleThreshold", UIMin="0", ClampMin="0"))
+	int32 ParallelTriangleThreshold = 8192;
+
 	/*
 		Subdivision Settings
 
@@ -241,9 +341,12 @@ struct WATERPHYSICS_API FWaterPhysicsSettings
 		Submerged Tessellation Settings
 
 		How to tessellate the submerged triangles. Increasing this number will improve the accuracy of the calculations at the cost of some performance.
+		Waterline mode only refines where the surface cuts the body, which allows for a coarse base mesh.
+		The water surface is sampled again at every vertex the tessellation inserts, which costs one water query per vertex.
+		Defaults to no tessellation.
 	*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Physics Settings", meta=(EditCondition = "bOverride_SubmergedTessellationSettings"))
-	FTessellationSettings SubmergedTessellationSettings;
+	FTessellationSettings SubmergedTessellationSettings = { EWaterPhysicsTessellationMode::Levels, 1.f, 0 };
 
 	/* 
 		Pressure Coefficient Of Linear Speed
@@ -365,6 +468,9 @@ struct WATERPHYSICS_API FWaterPhysicsSettings
 	EWaterPhysicsDebugLevel DebugFluidVelocity = EWaterPhysicsDebugLevel::None;
 
 	static FWaterPhysicsSettings MergeWaterPhysicsSettings(const FWaterPhysicsSettings& DefaultSettings, const FWaterPhysicsSettings& OverrideSettings);
+
+	// Verifies that every bOverride_ setting is handled by MergeWaterPhysicsSettings, called on module startup
+	static void CheckMergedSettings();
 };
 
 USTRUCT(BlueprintType)
@@ -467,7 +573,21 @@ struct FWaterPhysicsCollisionSetup
 	};
 	TArray<FSphylElem> SphylElems;
 
-	typedef WaterPhysics::FIndexedTriangleMesh FMeshElem;
+	// References its triangle mesh, which is immutable and can be shared, e.g. the cached mesh of a static mesh LOD used by many bodies.
+	// Transforming the element only accumulates Transform, it is applied to the vertices when they are read.
+	struct FMeshElem
+	{
+		typedef TSharedPtr<const WaterPhysics::FIndexedTriangleMesh, ESPMode::ThreadSafe> FSharedMesh;
+
+		explicit FMeshElem(const FSharedMesh& InMesh) : Mesh(InMesh) {}
+		explicit FMeshElem(WaterPhysics::FIndexedTriangleMesh&& InMesh) : Mesh(MakeShared<WaterPhysics::FIndexedTriangleMesh, ESPMode::ThreadSafe>(MoveTemp(InMesh))) {}
+
+		FSharedMesh Mesh;
+		FTransform  Transform = FTransform::Identity;
+
+		FORCEINLINE int32   NumTriangles() const { return Mesh->IndexList.Num() / 3; }
+		FORCEINLINE FVector GetVertex(int32 Index) const { return Transform.TransformPosition(Mesh->VertexList[Index]); }
+	};
 	TArray<FMeshElem> MeshElems;
 
 	FORCEINLINE int32 NumCollisionElems() const { return SphereElems.Num() + BoxElems.Num() + SphylElems.Num() + MeshElems.Num(); }
@@ -110,11 +110,12 @@ void FWaterPhysicsCollisionComponentVisualizer::DrawVisualization(const UActorCo
 	{
 		TransformMeshElem(MeshElem, CollisionTransform);
 
-		for (int32 i = 0; i < MeshElem.IndexList.Num(); i+=3)
+		const WaterPhysics::FIndexList& IndexList = MeshElem.Mesh->IndexList;
+		for (int32 i = 0; i < IndexList.Num(); i+=3)
 		{
-			const FVector V0 = MeshElem.VertexList[MeshElem.IndexList[i+0]];
-			const FVector V1 = MeshElem.VertexList[MeshElem.IndexList[i+1]];
-			const FVector V2 = MeshElem.VertexList[MeshElem.IndexList[i+2]];
+			const FVector V0 = MeshElem.GetVertex(IndexList[i+0]);
+			const FVector V1 = MeshElem.GetVertex(IndexList[i+1]);
+			const FVector V2 = MeshElem.GetVertex(IndexList[i+2]);
 			
 			PDI->DrawLine(V0, V1, ShapeColor, SDPG_World, LineThickness, 0.001f, false);
 			PDI->DrawLine(V1, V2, ShapeColor, SDPG_World, LineThickness, 0.001f, false);